@@ -4,73 +4,218 @@
 #include <fstream>
 #include <sstream>
 #include <fmt/ostream.h>
+#include "core/Assets.h"
+
+Game::Game(const GameOptions& options) : metricsExporter(metrics),
+               renderWindow(sf::VideoMode(sf::Vector2u(800, 600)), "Monkey Typer"),
+               renderer(renderWindow.getSize(), GameSession::maxWords, options.lanes),
+               framePacer(options.framePacing, options.targetFps) {
+    //Split-screen lanes are independent sessions over the same word list and generator
+    sessions.reserve(options.lanes);
+    for (auto i = 0; i < options.lanes; i++) {
+        sessions.emplace_back(wordList, Difficulty::Easy, seedGenerator(), static_cast<float>(renderWindow.getSize().x));
+    }
+
+    //Every lane streams the level through a reader of its own, they only share the file.
+    //Either every lane plays the level or none does
+    if (!options.levelPath.empty()) {
+        levels = std::vector<LevelReader>(options.lanes);
+        auto opened = std::all_of(levels.begin(), levels.end(), [&options](LevelReader& level) {
+            return level.open(options.levelPath);
+        });
+        if (opened) {
+            for (auto i = 0; i < options.lanes; i++) {
+                sessions[i].setLevel(&levels[i]);
+            }
+        } else {
+            fmt::print(stderr, "Could not open level {}\n", options.levelPath);
+            levels.clear();
+        }
+    }
 
-#include "SFML/Audio/Sound.hpp"
-#include "SFML/Audio/SoundBuffer.hpp"
+    //Room for a full pool of words in every lane of every snapshot, so publishing never has to grow them
+    snapshots.forEachBuffer([&options](FrameSnapshot& snapshot) {
+        snapshot.lanes.resize(options.lanes);
+        for (auto& lane : snapshot.lanes) {
+            lane.words.reserve(GameSession::maxWords);
+        }
+    });
 
-Game::Game() : renderWindow(sf::VideoMode(sf::Vector2u(800, 600)), "Monkey Typer") {
-    if (!loadFont("arial.ttf")) {
-        renderWindow.close();
+    //The render thread rewrites its button texts on a font change, menus dispatch on a copy of the labels instead
+    for (auto state = 0; state <= static_cast<int>(GameState::Pause); state++) {
+        buttonLabels.push_back(Renderer::getButtonLabels(static_cast<GameState>(state), framePacer.getTargetFps()));
     }
 
-    loadBackground();
+    allocationGuard = options.allocationGuard;
+    currentState = GameState::Menu;
+    selectedFramePacing = options.framePacing;
+    framePacer.apply(renderWindow);
+    currentDifficulty = Difficulty::Easy;
+    currentWordPackage = WordPackage::English;
+
+    if (options.metricsPort != 0) {
+        metricsExporter.startTcp(options.metricsPort);
+    } else if (!options.metricsSocket.empty()) {
+        metricsExporter.startUnix(options.metricsSocket);
+    }
+    if (!options.eventLogPath.empty() && !eventLog.open(options.eventLogPath)) {
+        fmt::print(stderr, "Could not open event log {}\n", options.eventLogPath);
+    }
+
+    startLoading();
+}
+
+auto Game::startLoading() -> void {
+    //Decoding runs on worker threads, anything touching the GPU waits for finishLoading on this thread
+    loadingTasks.push_back(std::async(std::launch::async, [this] {
+        auto start = startupProfiler.now();
+        fontLoaded = renderer.loadFont("arial.ttf");
+        startupProfiler.record("font", start);
+    }));
+
+    loadingTasks.push_back(std::async(std::launch::async, [this] {
+        auto start = startupProfiler.now();
+        backgroundLoaded = Assets::loadImage(backgroundImage, "background.png");
+        startupProfiler.record("background decode", start);
+    }));
+
+    loadingTasks.push_back(std::async(std::launch::async, [this] {
+        auto start = startupProfiler.now();
+        logoLoaded = Assets::loadImage(logoImage, "logo.png");
+        startupProfiler.record("logo decode", start);
+    }));
+
+    loadingTasks.push_back(std::async(std::launch::async, [this] {
+        auto start = startupProfiler.now();
+        sounds.loadCue(SoundCue::Hit, "sounds/score.mp3");
+        sounds.synthesizeCue(SoundCue::Miss, 220.0f, 160.0f, 0.12f);
+        sounds.synthesizeCue(SoundCue::Damage, 440.0f, 110.0f, 0.35f);
+        startupProfiler.record("sounds", start);
+    }));
+
+    loadingTasks.push_back(std::async(std::launch::async, [this] {
+        auto start = startupProfiler.now();
+        loadLeaderboard();
+        loadWordPackage();
+        startupProfiler.record("leaderboard and words", start);
+    }));
+}
+
+auto Game::isLoaded() const -> bool {
+    return std::all_of(loadingTasks.begin(), loadingTasks.end(), [](const std::future<void>& task) {
+        return task.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    });
+}
 
-    soundBuffer = new sf::SoundBuffer();
-    if (soundBuffer->loadFromFile("assets/sounds/score.mp3")) {
-        sound = new sf::Sound(*soundBuffer);
-        sound->setVolume(50.0f);
+auto Game::waitForLoading() -> void {
+    for (auto& task : loadingTasks) {
+        if (task.valid()) {
+            task.wait();
+        }
+    }
+}
+
+auto Game::finishLoading() -> bool {
+    for (auto& task : loadingTasks) {
+        task.get();
+    }
+    loadingTasks.clear();
+
+    //Without a font nothing can be drawn, the images are decoration the menus do without
+    if (!fontLoaded) {
+        fmt::print(stderr, "Could not load fonts/arial.ttf\n");
+        return false;
+    }
+    if (!backgroundLoaded) {
+        fmt::print(stderr, "Could not load background.png\n");
+    }
+    if (!logoLoaded) {
+        fmt::print(stderr, "Could not load logo.png\n");
     }
 
-    auto buttonWidth = 200.0f;
-    auto buttonHeight = 50.0f;
-    auto buttonSpacing = 20.0f;
+    auto start = startupProfiler.now();
+    auto uploaded = renderer.loadTextures(backgroundImage, logoImage);
+    if (!uploaded && backgroundLoaded && logoLoaded) {
+        fmt::print(stderr, "Could not upload the background and logo textures\n");
+    }
+    backgroundImage = sf::Image();
+    logoImage = sf::Image();
+    startupProfiler.record("texture upload", start);
 
-    createButtons(menuButtons,
-                  {"Play", "Settings", "Leaderboard", "Load Game"},
-                  200, buttonWidth, buttonHeight, buttonSpacing);
+    renderer.createAllButtons(framePacer.getTargetFps());
+    selectedFont = renderer.getCurrentFont();
+    renderer.warmGlyphs(wordCharacters);
+    renderer.resetTextGeometry();
+    return true;
+}
 
-    createButtons(gameOverButtons,
-                  {"Play Again", "Main Menu"},
-                  300, buttonWidth, buttonHeight, buttonSpacing);
+auto Game::renderLoadingScreen() -> void {
+    auto finished = std::count_if(loadingTasks.begin(), loadingTasks.end(), [](const std::future<void>& task) {
+        return task.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    });
+    auto progress = static_cast<float>(finished) / loadingTasks.size();
 
-    createButtons(pauseButtons,
-                  {"Continue", "Save Game", "Main Menu"},
-                  200, buttonWidth, buttonHeight, buttonSpacing);
+    renderer.renderLoadingScreen(renderWindow, progress);
+    renderWindow.display();
+}
 
-    createButtons(settingsButtons,
-                  {"Difficulty", "Word Package", "Font", "Back to Menu"},
-                  200, buttonWidth, buttonHeight, buttonSpacing);
+auto Game::run() -> int {
+    auto firstFrame = true;
+    while (renderWindow.isOpen() && (firstFrame || !isLoaded())) {
+        processEvents();
+        renderLoadingScreen();
+        framePacer.waitForNextFrame();
 
-    createButtons(difficultyButtons,
-                  {"Easy", "Medium", "Hard", "Back"},
-                  200, buttonWidth, buttonHeight, buttonSpacing);
+        if (firstFrame) {
+            startupProfiler.milestone("time to first frame");
+            firstFrame = false;
+        }
+    }
 
-    createButtons(wordPackageButtons,
-                  {"English Words", "Polish Words", "Back"},
-                  200, buttonWidth, buttonHeight, buttonSpacing);
+    //The tasks write into this object, they have to be done before run() returns, however it returns
+    waitForLoading();
+    if (!renderWindow.isOpen() || !finishLoading()) {
+        renderWindow.close();
+        return 0;
+    }
 
-    createButtons(fontButtons,
-                  {"Arial", "Calibri", "Consolas", "Back"},
-                  200, buttonWidth, buttonHeight, buttonSpacing);
+    if (allocationGuard) {
+        //Straight into a round, the guard judges its frames once they have settled
+        currentState = GameState::Game;
+        resetGame();
+    }
 
-    currentState = GameState::Menu;
-    renderWindow.setFramerateLimit(60);
-    lastWordSpawn = std::chrono::steady_clock::now();
-    score = 0;
-    currentDifficulty = Difficulty::Easy;
-    health = getMaxHealth();
-    loadLeaderboard();
-    currentWordPackage = WordPackage::English;
-    loadWordPackage();
-    currentFont = "arial.ttf";
-}
+    publishSnapshot();
+    simulationThread = std::jthread([this](std::stop_token stopToken) {
+        simulationLoop(stopToken);
+    });
 
-auto Game::run() -> void {
+    auto interactive = false;
     while (renderWindow.isOpen()) {
-        processEvents();
-        update();
-        render();
+        {
+            auto scope = AllocationScope(AllocationPhase::Events);
+            processEvents();
+        }
+        {
+            auto scope = AllocationScope(AllocationPhase::Render);
+            snapshots.update();
+            render(snapshots.readBuffer());
+        }
+        framePacer.waitForNextFrame();
+        checkRenderAllocations(snapshots.readBuffer().state);
+
+        metrics.frameTime.record(framePacer.getLastFrameTime());
+        metrics.frames.fetch_add(1, std::memory_order_relaxed);
+
+        if (!interactive) {
+            startupProfiler.milestone("time to interactive");
+            interactive = true;
+        }
     }
+
+    simulationThread.request_stop();
+    simulationThread.join();
+    return allocationGuardFailed ? 1 : 0;
 }
 
 auto Game::processEvents() -> void {
@@ -78,100 +223,124 @@ auto Game::processEvents() -> void {
         if (event->is<sf::Event::Closed>()) {
             renderWindow.close();
         }
+        else {
+            inputQueue.push(*event);
+        }
+    }
+}
 
-        if (event->is<sf::Event::KeyPressed>()) {
-            auto keyEvent = event->getIf<sf::Event::KeyPressed>();
-            if (keyEvent) {
-                if (keyEvent->code == sf::Keyboard::Key::Escape) {
-                    if (currentState == GameState::Game) {
-                        currentState = GameState::Pause;
-                    }
-                    else if (currentState == GameState::Pause) {
-                        currentState = GameState::Game;
-                    }
-                    else if (currentState != GameState::Menu) {
-                        currentState = GameState::Menu;
-                        resetGame();
-                    }
+auto Game::simulationLoop(std::stop_token stopToken) -> void {
+    //Fixed 60 Hz step, word speeds are expressed in pixels per tick
+    const auto tickDuration = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / 60.0));
+    auto nextTick = std::chrono::steady_clock::now();
+    //Its ring is allocated here rather than on the first spawn, which lands after the allocation guard's warm-up
+    eventLog.attachThread();
+
+    while (!stopToken.stop_requested()) {
+        auto previousState = currentState;
+        {
+            auto scope = AllocationScope(AllocationPhase::Input);
+            inputQueue.drain(pendingEvents);
+            for (const auto& queued : pendingEvents) {
+                handleEvent(queued.event);
+                metrics.inputLatency.record(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - queued.polledAt).count());
+            }
+        }
+        {
+            auto scope = AllocationScope(AllocationPhase::Update);
+            update();
+        }
+        {
+            auto scope = AllocationScope(AllocationPhase::Snapshot);
+            if (currentState != previousState) {
+                logStateChange(previousState);
+            }
+            publishSnapshot();
+            publishMetrics();
+        }
+        checkSimulationAllocations(previousState);
+
+        nextTick += tickDuration;
+        auto currentTime = std::chrono::steady_clock::now();
+        if (currentTime - nextTick > tickDuration * 10) {
+            nextTick = currentTime;
+        }
+        FramePacer::preciseSleepUntil(nextTick);
+    }
+}
+
+auto Game::handleEvent(const sf::Event& event) -> void {
+    if (event.is<sf::Event::KeyPressed>()) {
+        auto keyEvent = event.getIf<sf::Event::KeyPressed>();
+        if (keyEvent) {
+            if (keyEvent->code == sf::Keyboard::Key::Escape) {
+                if (currentState == GameState::Game) {
+                    currentState = GameState::Pause;
                 }
-                else if (currentState == GameState::Game) {
-                    if (keyEvent->code == sf::Keyboard::Key::Enter) {
-                        if (!currentInput.empty()) {
-                            checkWord();
-                            currentInput.clear();
-                        }
-                    }
-                    else if (keyEvent->code == sf::Keyboard::Key::Backspace) {
-                        if (!currentInput.empty()) {
-                            currentInput.pop_back();
-                        }
-                    }
-                    else if (keyEvent->code >= sf::Keyboard::Key::A && keyEvent->code <= sf::Keyboard::Key::Z) {
-                        char c = static_cast<char>('a' + (static_cast<int>(keyEvent->code) - static_cast<int>(sf::Keyboard::Key::A)));
-                        currentInput += c;
-                    }
+                else if (currentState == GameState::Pause) {
+                    currentState = GameState::Game;
                 }
-                else if (currentState != GameState::Game) {
-                    std::vector<Button>* currentButtons = nullptr;
-                    switch (currentState) {
-                        case GameState::Menu:
-                            currentButtons = &menuButtons;
-                            break;
-                        case GameState::Pause:
-                            currentButtons = &pauseButtons;
-                            break;
-                        case GameState::GameOver:
-                            currentButtons = &gameOverButtons;
-                            break;
-                        case GameState::Settings:
-                            currentButtons = &settingsButtons;
-                            break;
-                        case GameState::SettingsDifficulty:
-                            currentButtons = &difficultyButtons;
-                            break;
-                        case GameState::SettingsWordPackage:
-                            currentButtons = &wordPackageButtons;
-                            break;
-                        case GameState::SettingsFont:
-                            currentButtons = &fontButtons;
-                            break;
-                        default:
-                            break;
-                    }
+                else if (currentState != GameState::Menu) {
+                    currentState = GameState::Menu;
+                    resetGame();
+                }
+            }
+            else if (currentState == GameState::Game) {
+                if (keyEvent->code == sf::Keyboard::Key::Enter) {
+                    checkWord();
+                }
+                else if (keyEvent->code == sf::Keyboard::Key::Tab) {
+                    switchLane();
+                }
+                else if (keyEvent->code == sf::Keyboard::Key::Backspace) {
+                    getActiveSession().backspace();
+                }
+                else if (keyEvent->code >= sf::Keyboard::Key::A && keyEvent->code <= sf::Keyboard::Key::Z) {
+                    char c = static_cast<char>('a' + (static_cast<int>(keyEvent->code) - static_cast<int>(sf::Keyboard::Key::A)));
+                    getActiveSession().typeCharacter(c);
+                }
+            }
+            else if (currentState != GameState::Game) {
+                const auto& labels = buttonLabels[static_cast<int>(currentState)];
 
-                    if (currentButtons) {
-                        if (keyEvent->code == sf::Keyboard::Key::Up) {
-                            selectedButtonIndex = (selectedButtonIndex - 1 + currentButtons->size()) % currentButtons->size();
-                        }
-                        else if (keyEvent->code == sf::Keyboard::Key::Down) {
-                            selectedButtonIndex = (selectedButtonIndex + 1) % currentButtons->size();
-                        }
-                        else if (keyEvent->code == sf::Keyboard::Key::Enter) {
-                            switch (currentState) {
-                                case GameState::Menu:
-                                    handleMenuSelection(selectedButtonIndex);
-                                    break;
-                                case GameState::Pause:
-                                    handlePauseSelection(selectedButtonIndex);
-                                    break;
-                                case GameState::GameOver:
-                                    handleGameOverSelection(selectedButtonIndex);
-                                    break;
-                                case GameState::Settings:
-                                    handleSettingsSelection(selectedButtonIndex);
-                                    break;
-                                case GameState::SettingsDifficulty:
-                                    handleDifficultySelection(selectedButtonIndex);
-                                    break;
-                                case GameState::SettingsWordPackage:
-                                    handleWordPackageSelection(selectedButtonIndex);
-                                    break;
-                                case GameState::SettingsFont:
-                                    handleFontSelection(selectedButtonIndex);
-                                    break;
-                                default:
-                                    break;
-                            }
+                if (!labels.empty()) {
+                    if (keyEvent->code == sf::Keyboard::Key::Up) {
+                        selectedButtonIndex = (selectedButtonIndex - 1 + labels.size()) % labels.size();
+                    }
+                    else if (keyEvent->code == sf::Keyboard::Key::Down) {
+                        selectedButtonIndex = (selectedButtonIndex + 1) % labels.size();
+                    }
+                    else if (keyEvent->code == sf::Keyboard::Key::Enter) {
+                        switch (currentState) {
+                            case GameState::Menu:
+                                handleMenuSelection(selectedButtonIndex);
+                                break;
+                            case GameState::Pause:
+                                handlePauseSelection(selectedButtonIndex);
+                                break;
+                            case GameState::GameOver:
+                                handleGameOverSelection(selectedButtonIndex);
+                                break;
+                            case GameState::Settings:
+                                handleSettingsSelection(selectedButtonIndex);
+                                break;
+                            case GameState::SettingsDifficulty:
+                                handleDifficultySelection(selectedButtonIndex);
+                                break;
+                            case GameState::SettingsWordPackage:
+                                handleWordPackageSelection(selectedButtonIndex);
+                                break;
+                            case GameState::SettingsFont:
+                                handleFontSelection(selectedButtonIndex);
+                                break;
+                            case GameState::SettingsFramePacing:
+                                handleFramePacingSelection(selectedButtonIndex);
+                                break;
+                            case GameState::SettingsTypoTolerance:
+                                handleTypoToleranceSelection(selectedButtonIndex);
+                                break;
+                            default:
+                                break;
                         }
                     }
                 }
@@ -182,303 +351,257 @@ auto Game::processEvents() -> void {
 
 auto Game::update() -> void {
     if (currentState == GameState::Game) {
-        auto currentTime = std::chrono::steady_clock::now();
-
-        if (std::chrono::duration<float>(currentTime - lastWordSpawn).count() > getSpawnInterval()) {
-            spawnWord();
-            lastWordSpawn = currentTime;
+        for (auto& session : sessions) {
+            auto health = session.getHealth();
+            session.update();
+            if (session.getHealth() < health) {
+                sounds.play(SoundCue::Damage);
+            }
         }
-
-        for (auto& word : words) {
-            word.update();
+        if (getActiveSession().isOver()) {
+            switchLane();
         }
-
-        const auto windowWidth = renderWindow.getSize().x;
-        words.erase(
-            std::remove_if(words.begin(), words.end(),
-                [this, windowWidth](const Word& word) {
-                    if (word.isOffScreen(windowWidth)) {
-                        decreaseHealth();
-                        return true;
-                    }
-                    return false;
-                }),
-            words.end()
-        );
+        checkGameOver();
     }
+}
 
-    std::vector<Button>* currentButtons = nullptr;
-    switch (currentState) {
-        case GameState::Menu:
-            currentButtons = &menuButtons;
-            break;
-        case GameState::Pause:
-            currentButtons = &pauseButtons;
-            break;
-        case GameState::GameOver:
-            currentButtons = &gameOverButtons;
-            break;
-        case GameState::Settings:
-            currentButtons = &settingsButtons;
-            break;
-        case GameState::SettingsDifficulty:
-            currentButtons = &difficultyButtons;
-            break;
-        case GameState::SettingsWordPackage:
-            currentButtons = &wordPackageButtons;
-            break;
-        case GameState::SettingsFont:
-            currentButtons = &fontButtons;
-            break;
-        default:
-            break;
-    }
+auto Game::publishSnapshot() -> void {
+    auto& snapshot = snapshots.writeBuffer();
+    snapshot.tick = tick++;
+    snapshot.state = currentState;
+    snapshot.selectedButtonIndex = selectedButtonIndex;
 
-    if (currentButtons) {
-        for (auto i = 0; i < currentButtons->size(); i++) {
-            auto& button = (*currentButtons)[i];
-            button.setSelected(i == selectedButtonIndex);
-        }
-    }
-}
+    snapshot.lanes.resize(sessions.size());
+    for (auto i = 0; i < sessions.size(); i++) {
+        const auto& session = sessions[i];
+        auto& lane = snapshot.lanes[i];
 
-auto Game::render() -> void {
-    renderWindow.clear(sf::Color(30, 30, 30));
+        const auto& words = session.getWords();
+        lane.words.resize(words.size());
+        auto view = lane.words.begin();
+        for (auto iterator = words.begin(); iterator != words.end(); ++iterator, ++view) {
+            view->handle = iterator.handle();
+            view->text = iterator->getText();
+            view->position = iterator->getPosition();
+        }
 
-    if (background) {
-        renderWindow.draw(*background);
+        lane.currentInput = session.getCurrentInput();
+        lane.score = session.getScore();
+        lane.health = session.getHealth();
+        lane.over = session.isOver();
+        lane.levelComplete = session.isLevelComplete();
     }
+    snapshot.activeLane = activeLane;
+    snapshot.difficulty = currentDifficulty;
+    snapshot.wordPackage = currentWordPackage;
+    snapshot.font = selectedFont;
+    snapshot.wordCharacters = wordCharacters;
+    snapshot.framePacing = selectedFramePacing;
+    snapshot.typoTolerance = getActiveSession().getTypoTolerance();
 
-    switch (currentState) {
-        case GameState::Menu:
-            renderMenuScreen();
-            break;
-        case GameState::Game:
-            renderGameScreen();
-            break;
-        case GameState::Pause:
-            renderPauseScreen();
-            break;
-        case GameState::GameOver:
-            renderGameOverScreen();
-            break;
-        case GameState::Settings:
-            renderSettingsScreen();
-            break;
-        case GameState::SettingsDifficulty:
-            renderDifficultySettingsScreen();
-            break;
-        case GameState::SettingsWordPackage:
-            renderWordPackageSettingsScreen();
-            break;
-        case GameState::SettingsFont:
-            renderFontSettingsScreen();
-            break;
-        case GameState::Leaderboard:
-            renderLeaderboardScreen();
-            break;
+    if (currentState == GameState::Leaderboard) {
+        auto rows = std::min<std::size_t>(10, leaderboard.size());
+        snapshot.leaderboard.assign(leaderboard.begin(), leaderboard.begin() + rows);
     }
 
-    renderWindow.display();
+    snapshots.publish();
 }
 
-auto Game::resetGame() -> void {
-    words.clear();
-    currentInput.clear();
-    score = 0;
-    health = getMaxHealth();
-    lastWordSpawn = std::chrono::steady_clock::now();
-    lastFrame = std::chrono::steady_clock::now();
+auto Game::publishMetrics() -> void {
+    //Word counts add up over the lanes, score and health are the active lane's
+    auto wordsSpawned = std::uint64_t(0);
+    auto liveWords = std::size_t(0);
+    for (const auto& session : sessions) {
+        wordsSpawned += session.getSpawnCount();
+        liveWords += session.getWords().size();
+    }
+
+    const auto& session = getActiveSession();
+    metrics.ticks.fetch_add(1, std::memory_order_relaxed);
+    metrics.wordsSpawned.store(wordsSpawned, std::memory_order_relaxed);
+    metrics.liveWords.store(liveWords, std::memory_order_relaxed);
+    metrics.score.store(session.getScore(), std::memory_order_relaxed);
+    metrics.health.store(session.getHealth(), std::memory_order_relaxed);
+    metrics.gameState.store(static_cast<int>(currentState), std::memory_order_relaxed);
+    metrics.spawnIntervalSeconds.store(session.getSpawnInterval(), std::memory_order_relaxed);
 }
 
-auto Game::decreaseHealth() -> void {
-    health--;
-    if (health <= 0) {
-        currentState = GameState::GameOver;
-        saveScore();
+auto Game::logStateChange(const GameState& previousState) -> void {
+    auto sessionTick = getActiveSession().getTick();
+    if (previousState == GameState::Game && currentState == GameState::Pause) {
+        eventLog.log(GameEventType::Pause, round, sessionTick);
+    } else if (previousState == GameState::Pause && currentState == GameState::Game) {
+        eventLog.log(GameEventType::Resume, round, sessionTick);
     }
+    eventLog.log(GameEventType::StateChange, round, sessionTick, {},
+                 static_cast<float>(previousState), static_cast<float>(currentState));
 }
 
-auto Game::checkWord() -> void {
-    auto iterator = std::find_if(words.begin(), words.end(),
-        [this](const Word& word) {return word.getText() == currentInput;});
-
-    if (iterator != words.end()) {
-        words.erase(iterator);
-        score += 10 * getScoreMultiplier();
+auto Game::checkRenderAllocations(const GameState& state) -> void {
+    if (!AllocationTracker::isEnabled()) {
+        return;
+    }
 
-        if (sound) {
-            sound->play();
-        }
+    renderFramesInGame = state == GameState::Game ? renderFramesInGame + 1 : 0;
+    if (!renderAllocations.endFrame(renderFramesInGame > allocationWarmupFrames)) {
+        allocationGuardFailed = true;
     }
-    else {
-        decreaseHealth();
+    if (allocationGuard && isAllocationGuardDone()) {
+        renderWindow.close();
     }
 }
 
-auto Game::spawnWord() -> void {
-    //https://stackoverflow.com/questions/7560114/random-number-c-in-some-range
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> wordDist(0, wordList.size() - 1);
-    std::uniform_int_distribution<> y(50, 500);
-    float yDist = y(gen);
-
-    words.push_back({wordList[wordDist(gen)], 0, yDist, getWordSpeed(), font});
-}
-
-auto Game::renderMenuScreen() -> void {
-    auto const texture = sf::Texture("assets/logo.png");
-    auto logoImage = sf::Sprite(texture);
-
-    auto const textureSize = texture.getSize();
-    auto const width = 300.0f;
-    auto const scale = width / textureSize.x;
-    logoImage.setScale({scale, scale});
-
-    logoImage.setPosition({(renderWindow.getSize().x - logoImage.getGlobalBounds().size.x) / 2, 10});
-    renderWindow.draw(logoImage);
-
-    Button::drawButtons(menuButtons, renderWindow);
-}
-
-auto Game::renderGameScreen() -> void {
-    for (auto& word : words) {
-        word.draw(renderWindow);
+auto Game::checkSimulationAllocations(const GameState& previousState) -> void {
+    if (!AllocationTracker::isEnabled()) {
+        return;
     }
 
-    renderWindow.draw(setupText(currentInput, 24, sf::Color::Green, sf::Vector2f(10, 550)));
-    renderWindow.draw(setupText(fmt::format("Score: {}", score), 24, sf::Color::White, sf::Vector2f(650, 550)));
-    renderWindow.draw(setupText(fmt::format("Health: {}", health), 24, sf::Color::Red, sf::Vector2f(10, 20)));
-    renderWindow.draw(setupText(fmt::format("Difficulty: {}", getDifficultyString()), 24, sf::Color::Yellow, sf::Vector2f(650, 20)));
-}
-
-auto Game::renderGameOverScreen() -> void {
-    renderWindow.draw(setupText("Game Over!", 60, sf::Color::Red, sf::Vector2f(0, 150), true));
-    renderWindow.draw(setupText(fmt::format("Achieved score: {}", score), 30, sf::Color::White, sf::Vector2f(0, 220), true));
-
-    Button::drawButtons(gameOverButtons, renderWindow);
+    //A tick that enters or leaves a round is never steady, game over for example writes the leaderboard
+    ticksInGame = previousState == GameState::Game && currentState == GameState::Game ? ticksInGame + 1 : 0;
+    if (!simulationAllocations.endFrame(ticksInGame > allocationWarmupFrames)) {
+        allocationGuardFailed = true;
+    }
+    simulationSteadyTicks.store(simulationAllocations.getSteadyFrames(), std::memory_order_relaxed);
 }
 
-auto Game::renderPauseScreen() -> void {
-    renderGameScreen();
-
-    sf::RectangleShape darkenLayer(sf::Vector2f(800, 600));
-    darkenLayer.setFillColor(sf::Color(0, 0, 0, 150));
-    renderWindow.draw(darkenLayer);
-
-    renderWindow.draw(setupText("Game Paused", 60, sf::Color::White, sf::Vector2f(0, 100), true));
+auto Game::isAllocationGuardDone() -> bool {
+    if (allocationGuardFailed) {
+        fmt::print(stderr, "[alloc] guard failed: a steady gameplay frame allocated\n");
+        return true;
+    }
 
-    Button::drawButtons(pauseButtons, renderWindow);
+    auto steadyFrames = renderAllocations.getSteadyFrames();
+    auto steadyTicks = simulationSteadyTicks.load(std::memory_order_relaxed);
+    auto roundOver = steadyFrames > 0 && renderFramesInGame == 0;
+    if ((steadyFrames >= allocationGuardFrames && steadyTicks >= allocationGuardFrames) || roundOver) {
+        fmt::print(stderr, "[alloc] guard passed: {} frames and {} ticks without allocations\n", steadyFrames, steadyTicks);
+        return true;
+    }
+    return false;
 }
 
-auto Game::renderSettingsScreen() -> void {
-    renderWindow.draw(setupText("Settings", 60, sf::Color::White, sf::Vector2f(0, 100), true));
+auto Game::render(const FrameSnapshot& snapshot) -> void {
+    if (snapshot.framePacing != framePacer.getMode()) {
+        framePacer.setMode(snapshot.framePacing);
+        framePacer.apply(renderWindow);
+    }
 
-    Button::drawButtons(settingsButtons, renderWindow);
+    if (snapshot.state == GameState::SettingsFramePacing) {
+        renderer.setFrameStats(framePacer.getStats());
+    }
+    renderer.render(renderWindow, snapshot);
 
-    renderWindow.draw(setupText(
-        fmt::format("Current: {}, {}", getDifficultyString(), getWordPackageString()),
-        24, sf::Color::Yellow, sf::Vector2f(0, 500), true
-    ));
+    auto scope = AllocationScope(AllocationPhase::Present);
+    renderWindow.display();
 }
 
-auto Game::renderDifficultySettingsScreen() -> void {
-    renderWindow.draw(setupText("Select Difficulty", 60, sf::Color::White, sf::Vector2f(0, 100), true));
-
-    Button::drawButtons(difficultyButtons, renderWindow);
-
-    renderWindow.draw(setupText(
-        "Easy: 3 health, slow speed, multiplier 1x\n"
-        "Medium: 2 health, medium speed, multiplier 1.3x\n"
-        "Hard: 1 health, fast speed, multiplier 1.5x",
-        20, sf::Color::Yellow, sf::Vector2f(0, 475), true
-    ));
+auto Game::resetGame() -> void {
+    //All lanes share a seed each round, so a head-to-head race gets the same words in the same places
+    auto seed = seedGenerator();
+    for (auto& session : sessions) {
+        session.reseed(seed);
+        session.reset(currentDifficulty);
+    }
+    startRound();
 }
 
-auto Game::renderWordPackageSettingsScreen() -> void {
-    renderWindow.draw(setupText("Select Word Package", 60, sf::Color::White, sf::Vector2f(0, 100), true));
+auto Game::startRound() -> void {
+    activeLane = 0;
 
-    Button::drawButtons(wordPackageButtons, renderWindow);
+    //Every lane of every reset or loaded save is logged as its own session
+    if (eventLog.isOpen()) {
+        for (auto& session : sessions) {
+            session.setEventLog(&eventLog, ++round);
+        }
+    }
 }
 
-auto Game::renderFontSettingsScreen() -> void {
-    renderWindow.draw(setupText("Select Font", 60, sf::Color::White, sf::Vector2f(0, 100), true));
-
-    Button::drawButtons(fontButtons, renderWindow);
-
-    renderWindow.draw(setupText(
-        fmt::format("Current: {}", currentFont),
-        24, sf::Color::Yellow, sf::Vector2f(0, 475), true
-    ));
+auto Game::getActiveSession() -> GameSession& {
+    return sessions[activeLane];
 }
 
-auto Game::renderLeaderboardScreen() -> void {
-    loadLeaderboard();
-
-    renderWindow.draw(setupText("Leaderboard", 60, sf::Color::White, sf::Vector2f(0, 50), true));
-    renderWindow.draw(setupText("Rank", 24, sf::Color::Yellow, sf::Vector2f(100, 120)));
-    renderWindow.draw(setupText("Score", 24, sf::Color::Yellow, sf::Vector2f(250, 120)));
-    renderWindow.draw(setupText("Date", 24, sf::Color::Yellow, sf::Vector2f(400, 120)));
-
-    auto yPosition = 170.0f;
-    auto spacing = 40.0f;
-    for (auto i = 0; i < 10 && i < leaderboard.size(); i++) {
-        const auto& entry = leaderboard[i];
-        renderWindow.draw(setupText(std::to_string(i + 1), 24, sf::Color::White, {100, yPosition}));
-        renderWindow.draw(setupText(entry[0], 24, sf::Color::White, {250, yPosition}));
-        renderWindow.draw(setupText(entry[1], 24, sf::Color::White, {400, yPosition}));
-        yPosition += spacing;
+auto Game::switchLane() -> void {
+    //Moves to the next lane still in play, the active one stays when no other is left
+    for (auto step = 1; step < sessions.size(); step++) {
+        auto lane = (activeLane + step) % static_cast<int>(sessions.size());
+        if (!sessions[lane].isOver()) {
+            activeLane = lane;
+            return;
+        }
     }
-
-    renderWindow.draw(setupText("Press ESC to return to menu", 20, sf::Color(200, 200, 200), sf::Vector2f(0, 550), true));
 }
 
-auto Game::loadBackground() -> void {
-    //https://www.youtube.com/watch?v=tXfdP3pcppI
-    backgroundTexture = new sf::Texture();
-    if (backgroundTexture->loadFromFile("assets/background.png")) {
-        background = new sf::Sprite(*backgroundTexture);
-
-        auto textureSize = backgroundTexture->getSize();
-        auto windowSize = renderWindow.getSize();
-
-        //https://www.geeksforgeeks.org/casting-operators-in-cpp/
-        float scaleX = static_cast<float>(windowSize.x) / textureSize.x;
-        float scaleY = static_cast<float>(windowSize.y) / textureSize.y;
-        auto scale = std::max(scaleX, scaleY);
-
-        background->setScale({scale, scale});
+auto Game::checkGameOver() -> void {
+    auto allOver = std::all_of(sessions.begin(), sessions.end(), [](const GameSession& session) {
+        return session.isOver();
+    });
+    if (currentState == GameState::Game && allOver) {
+        currentState = GameState::GameOver;
+        saveScore();
     }
 }
 
-auto Game::loadFont(const std::string& fontName) -> bool {
-    //https://www.sfml-dev.org/tutorials/3.0/graphics/text/
-    if (font.openFromFile("assets/fonts/" + fontName)) {
-        currentFont = fontName;
-        return true;
+auto Game::checkWord() -> void {
+    switch (getActiveSession().submit()) {
+        case SubmitResult::Hit:
+        case SubmitResult::NearHit:
+            sounds.play(SoundCue::Hit);
+            break;
+        case SubmitResult::Miss:
+            sounds.play(SoundCue::Miss);
+            break;
+        default:
+            break;
     }
-    return false;
+    checkGameOver();
 }
 
 auto Game::loadWordPackage() -> void {
     wordList.clear();
-    auto filename = "assets/packages/words_english.txt";
+    wordCharacters.clear();
+    auto filename = "packages/words_english.txt";
 
     switch (currentWordPackage) {
         case WordPackage::English:
-            filename = "assets/packages/words_english.txt";
+            filename = "packages/words_english.txt";
         break;
         case WordPackage::Polish:
-            filename = "assets/packages/words_polish.txt";
+            filename = "packages/words_polish.txt";
+        break;
+        case WordPackage::Generated:
+            filename = "packages/words_english.txt";
         break;
     }
 
-    auto file = std::fstream(filename);
-    auto word = std::string();
+    //A package that fails to load leaves the list empty, the sessions still have to let go of the old one
+    auto text = std::string();
+    if (Assets::readText(filename, text)) {
+        auto stream = std::istringstream(text);
+        auto word = std::string();
+
+        while (stream >> word) {
+            wordList.push_back(word);
+        }
+    }
+
+    //Distinct characters of the package, so the render thread can rasterize them up front
+    for (const auto& entry : wordList) {
+        for (auto c : sf::String(entry).toUtf32()) {
+            if (wordCharacters.find(c) == std::u32string::npos) {
+                wordCharacters += c;
+            }
+        }
+    }
+    std::sort(wordCharacters.begin(), wordCharacters.end());
 
-    while (file >> word) {
-        wordList.push_back(word);
+    //The generated package is trained on the English one and makes up new words from it at spawn time
+    if (currentWordPackage == WordPackage::Generated) {
+        wordGenerator.train(wordList);
+    }
+    //Sessions rebuild their word weights here, outside any round, so spawning never has to
+    for (auto& session : sessions) {
+        session.refreshWordList();
+        session.setWordGenerator(currentWordPackage == WordPackage::Generated ? &wordGenerator : nullptr);
     }
 }
 
@@ -521,29 +644,77 @@ auto Game::loadGame() -> bool {
 
     if (file.is_open()) {
         try {
+            struct SavedLane {
+                bool saved = false;
+                int score = 0;
+                int health = 0;
+                std::uint64_t tick = 0;
+                std::vector<Word> words;
+                std::vector<ScheduledTimer> timers;
+                std::optional<LevelPosition> level;
+            };
+
             std::string line;
             std::string key, value;
+            std::uint64_t levelHash = 0;
+            WordPackage wordPackage = currentWordPackage;
+            //Saves from before split-screen have no Lane lines and load into the first lane,
+            //lanes this game does not have are read into a slot that is then dropped
+            std::vector<SavedLane> lanes(sessions.size());
+            SavedLane ignored;
+            auto* lane = &lanes[0];
+            lane->saved = true;
 
             while (std::getline(file, line)) {
                 std::stringstream ss(line);
                 std::getline(ss, key, ':');
                 std::getline(ss, value);
 
-                if (key == "Score") {
-                    score = std::stoi(value);
+                if (key == "Lane") {
+                    auto index = std::stoul(value);
+                    lane = index < lanes.size() ? &lanes[index] : &ignored;
+                    lane->saved = true;
+                }
+                else if (key == "Score") {
+                    lane->score = std::stoi(value);
                 }
                 else if (key == "Health") {
-                    health = std::stoi(value);
+                    lane->health = std::stoi(value);
                 }
                 else if (key == "Difficulty") {
                     currentDifficulty = static_cast<Difficulty>(std::stoi(value));
                 }
                 else if (key == "WordPackage") {
-                    currentWordPackage = static_cast<WordPackage>(std::stoi(value));
+                    wordPackage = static_cast<WordPackage>(std::stoi(value));
+                }
+                else if (key == "Tick") {
+                    lane->tick = std::stoull(value);
+                }
+                else if (key == "LevelHash") {
+                    levelHash = std::stoull(value);
+                }
+                else if (key == "Level") {
+                    auto separator = value.find(';');
+                    lane->level = LevelPosition{std::stoull(value.substr(0, separator)), std::stoull(value.substr(separator + 1))};
+                }
+                else if (key == "Timers") {
+                    int timerCount = std::stoi(value);
+                    lane->timers.clear();
+
+                    for (int i = 0; i < timerCount; i++) {
+                        if (std::getline(file, line)) {
+                            std::stringstream timerSS(line);
+                            std::string event, dueTick;
+                            std::getline(timerSS, event, ';');
+                            std::getline(timerSS, dueTick);
+
+                            lane->timers.push_back({static_cast<ScheduledEvent>(std::stoi(event)), std::stoull(dueTick)});
+                        }
+                    }
                 }
                 else if (key == "Words") {
                     int wordCount = std::stoi(value);
-                    words.clear();
+                    lane->words.clear();
 
                     for (int i = 0; i < wordCount; i++) {
                         if (std::getline(file, line)) {
@@ -560,12 +731,34 @@ auto Game::loadGame() -> bool {
                             auto y = std::stof(entry[2]);
                             auto speed = std::stof(entry[3]);
 
-                            words.push_back({wordText, x, y, speed, font});
+                            lane->words.push_back({wordText, x, y, speed});
                         }
                     }
                 }
             }
 
+            //Level positions are byte offsets into the file the save was made with, any other level cannot use them
+            if (levelHash != getLevelHash()) {
+                fmt::print(stderr, "The saved game was played with a different level\n");
+                file.close();
+                return false;
+            }
+
+            //A different package means another word list, or a generator that still has to be trained
+            if (wordPackage != currentWordPackage) {
+                currentWordPackage = wordPackage;
+                loadWordPackage();
+            }
+
+            //Lanes the save does not have start fresh
+            resetGame();
+            for (auto i = 0; i < lanes.size(); i++) {
+                const auto& saved = lanes[i];
+                if (saved.saved) {
+                    sessions[i].restore(saved.score, saved.health, saved.words, saved.tick, saved.timers);
+                    sessions[i].restoreLevel(saved.level);
+                }
+            }
             file.close();
             return true;
         }
@@ -581,18 +774,37 @@ auto Game::saveGame() -> void {
     //https://stackoverflow.com/questions/8357240/how-to-automatically-convert-strongly-typed-enum-into-int
     std::ofstream file("assets/data/savegame.txt");
     if (file.is_open()) {
-        file << "Score:" << score << "\n"
-        << "Health:" << health << "\n"
-        << "Difficulty:" << static_cast<int>(currentDifficulty) << "\n"
+        file << "Difficulty:" << static_cast<int>(currentDifficulty) << "\n"
         << "WordPackage:" << static_cast<int>(currentWordPackage) << "\n";
+        if (auto levelHash = getLevelHash()) {
+            file << "LevelHash:" << levelHash << "\n";
+        }
+
+        for (auto i = 0; i < sessions.size(); i++) {
+            const auto& session = sessions[i];
+            file << "Lane:" << i << "\n"
+            << "Score:" << session.getScore() << "\n"
+            << "Health:" << session.getHealth() << "\n"
+            << "Tick:" << session.getTick() << "\n";
+            if (auto level = session.getLevelPosition()) {
+                file << "Level:" << level->offset << ";" << level->tick << "\n";
+            }
+
+            file << "Words:" << session.getWords().size() << "\n";
+            for (const auto& word : session.getWords()) {
+                auto pos = word.getPosition();
+                file << word.getText() << ";"
+                     << pos.x << ";"
+                     << pos.y << ";"
+                     << word.getSpeed() << "\n";
+            }
 
-        file << "Words:" << words.size() << "\n";
-        for (const auto& word : words) {
-            auto pos = word.getPosition();
-            file << word.getText() << ";"
-                 << pos.x << ";"
-                 << pos.y << ";"
-                 << word.getSpeed() << "\n";
+            auto timers = session.getTimers();
+            file << "Timers:" << timers.size() << "\n";
+            for (const auto& timer : timers) {
+                file << static_cast<int>(timer.event) << ";"
+                     << timer.dueTick << "\n";
+            }
         }
 
         file.close();
@@ -606,7 +818,9 @@ auto Game::saveScore() -> void {
     char buffer[32];
     std::strftime(buffer, 32, "%Y-%m-%d %H:%M:%S", std::localtime(&time_t));
 
-    leaderboard.push_back({std::to_string(score), buffer});
+    for (const auto& session : sessions) {
+        leaderboard.push_back({std::to_string(session.getScore()), buffer});
+    }
 
     std::ofstream file("assets/data/leaderboard.csv");
     if (file.is_open()) {
@@ -617,34 +831,22 @@ auto Game::saveScore() -> void {
     }
 }
 
-auto Game::createButtons(std::vector<Button>& buttonsVector,
-                        const std::vector<std::string>& buttonTexts,
-                        const float& marginTop,
-                        const float& buttonWidth,
-                        const float& buttonHeight,
-                        const float& spacing) -> void {
-    for (auto i = 0; i < buttonTexts.size(); i++) {
-        buttonsVector.push_back(
-            {
-                {(renderWindow.getSize().x - buttonWidth) / 2, marginTop + i * (buttonHeight + spacing)},
-                {buttonWidth, buttonHeight},
-                buttonTexts[i],
-                font
-            }
-        );
+auto Game::setTypoTolerance(const int& maxDistance) -> void {
+    for (auto& session : sessions) {
+        session.setTypoTolerance(maxDistance);
     }
 }
 
-auto Game::updateAllTexts() -> void {
-    auto allButtons = std::vector<std::vector<Button>>{
-        menuButtons, settingsButtons, difficultyButtons,
-        wordPackageButtons, fontButtons, gameOverButtons, pauseButtons
-    };
-    Button::updateAllButtons(allButtons, font);
+auto Game::getLevelHash() const -> std::uint64_t {
+    return levels.empty() ? 0 : levels[0].getHash();
+}
+
+auto Game::getButtonText(const GameState& state, const int& index) -> const std::string& {
+    return buttonLabels[static_cast<int>(state)][index];
 }
 
 auto Game::handleMenuSelection(int index) -> void {
-    auto selected = menuButtons[index].getText();
+    auto selected = getButtonText(GameState::Menu, index);
     selectedButtonIndex = 0;
 
     if (selected == "Play") {
@@ -653,6 +855,7 @@ auto Game::handleMenuSelection(int index) -> void {
     } else if (selected == "Settings") {
         currentState = GameState::Settings;
     } else if (selected == "Leaderboard") {
+        loadLeaderboard();
         currentState = GameState::Leaderboard;
     } else if (selected == "Load Game") {
         if (loadGame()) {
@@ -662,7 +865,7 @@ auto Game::handleMenuSelection(int index) -> void {
 }
 
 auto Game::handlePauseSelection(int index) -> void {
-    auto selected = pauseButtons[index].getText();
+    auto selected = getButtonText(GameState::Pause, index);
     selectedButtonIndex = 0;
 
     if (selected == "Continue") {
@@ -677,7 +880,7 @@ auto Game::handlePauseSelection(int index) -> void {
 }
 
 auto Game::handleGameOverSelection(int index) -> void {
-    auto selected = gameOverButtons[index].getText();
+    auto selected = getButtonText(GameState::GameOver, index);
     selectedButtonIndex = 0;
 
     if (selected == "Play Again") {
@@ -690,7 +893,7 @@ auto Game::handleGameOverSelection(int index) -> void {
 }
 
 auto Game::handleSettingsSelection(int index) -> void {
-    auto selected = settingsButtons[index].getText();
+    auto selected = getButtonText(GameState::Settings, index);
     selectedButtonIndex = 0;
 
     if (selected == "Difficulty") {
@@ -699,13 +902,17 @@ auto Game::handleSettingsSelection(int index) -> void {
         currentState = GameState::SettingsWordPackage;
     } else if (selected == "Font") {
         currentState = GameState::SettingsFont;
+    } else if (selected == "Frame Pacing") {
+        currentState = GameState::SettingsFramePacing;
+    } else if (selected == "Typo Tolerance") {
+        currentState = GameState::SettingsTypoTolerance;
     } else if (selected == "Back to Menu") {
         currentState = GameState::Menu;
     }
 }
 
 auto Game::handleDifficultySelection(int index) -> void {
-    auto selected = difficultyButtons[index].getText();
+    auto selected = getButtonText(GameState::SettingsDifficulty, index);
     selectedButtonIndex = 0;
 
     if (selected == "Easy") {
@@ -719,7 +926,7 @@ auto Game::handleDifficultySelection(int index) -> void {
 }
 
 auto Game::handleWordPackageSelection(int index) -> void {
-    auto selected = wordPackageButtons[index].getText();
+    auto selected = getButtonText(GameState::SettingsWordPackage, index);
     selectedButtonIndex = 0;
 
     if (selected == "English Words") {
@@ -728,98 +935,52 @@ auto Game::handleWordPackageSelection(int index) -> void {
     } else if (selected == "Polish Words") {
         currentWordPackage = WordPackage::Polish;
         loadWordPackage();
+    } else if (selected == "Generated Words") {
+        currentWordPackage = WordPackage::Generated;
+        loadWordPackage();
     }
     currentState = GameState::Settings;
 }
 
 auto Game::handleFontSelection(int index) -> void {
-    auto selected = fontButtons[index].getText();
+    auto selected = getButtonText(GameState::SettingsFont, index);
     selectedButtonIndex = 0;
 
+    //The font itself is owned by the render thread, it picks the change up from the next snapshot
     if (selected == "Arial") {
-        if (loadFont("arial.ttf")) {
-            updateAllTexts();
-        }
+        selectedFont = "arial.ttf";
     } else if (selected == "Calibri") {
-        if (loadFont("calibri.ttf")) {
-            updateAllTexts();
-        }
+        selectedFont = "calibri.ttf";
     } else if (selected == "Consolas") {
-        if (loadFont("consolas.ttf")) {
-            updateAllTexts();
-        }
+        selectedFont = "consolas.ttf";
     }
     currentState = GameState::Settings;
 }
 
-auto Game::setupText(const std::string& content, 
-                    const int& size, 
-                    const sf::Color& color,
-                    const sf::Vector2f& position, 
-                    const bool& centerX) const -> sf::Text {
-    sf::Text textObj(font, content, size);
-    textObj.setFillColor(color);
-    textObj.setOutlineThickness(2);
-
-    if (centerX) {
-        auto bounds = textObj.getLocalBounds();
-        textObj.setPosition({(renderWindow.getSize().x - bounds.size.x) / 2, position.y});
-    } else {
-        textObj.setPosition(position);
-    }
-
-    return textObj;
-}
-
-auto Game::getWordSpeed() const -> float {
-    switch (currentDifficulty) {
-        case Difficulty::Easy: return 2.0f;
-        case Difficulty::Medium: return 3.0f;
-        case Difficulty::Hard: return 4.0f;
-        default: return 2.0f;
-    }
-}
-
-auto Game::getSpawnInterval() const -> float {
-    switch (currentDifficulty) {
-        case Difficulty::Easy: return 2.0f;
-        case Difficulty::Medium: return 1.5f;
-        case Difficulty::Hard: return 1.0f;
-        default: return 2.0f;
-    }
-}
-
-auto Game::getScoreMultiplier() const -> float {
-    switch (currentDifficulty) {
-        case Difficulty::Easy: return 1.0f;
-        case Difficulty::Medium: return 1.3f;
-        case Difficulty::Hard: return 1.5f;
-        default: return 1.0f;
-    }
-}
+auto Game::handleFramePacingSelection(int index) -> void {
+    auto selected = getButtonText(GameState::SettingsFramePacing, index);
+    selectedButtonIndex = 0;
 
-auto Game::getMaxHealth() const -> int {
-    switch (currentDifficulty) {
-        case Difficulty::Easy: return 3;
-        case Difficulty::Medium: return 2;
-        case Difficulty::Hard: return 1;
-        default: return 3;
+    if (selected == "VSync") {
+        selectedFramePacing = FramePacing::VSync;
+    } else if (selected.starts_with("Capped")) {
+        selectedFramePacing = FramePacing::Capped;
+    } else if (selected == "Uncapped") {
+        selectedFramePacing = FramePacing::Uncapped;
     }
+    currentState = GameState::Settings;
 }
 
-auto Game::getDifficultyString() const -> std::string {
-    switch (currentDifficulty) {
-        case Difficulty::Easy: return "Easy";
-        case Difficulty::Medium: return "Medium";
-        case Difficulty::Hard: return "Hard";
-        default: return "Easy";
-    }
-}
+auto Game::handleTypoToleranceSelection(int index) -> void {
+    auto selected = getButtonText(GameState::SettingsTypoTolerance, index);
+    selectedButtonIndex = 0;
 
-auto Game::getWordPackageString() const -> std::string {
-    switch (currentWordPackage) {
-        case WordPackage::English: return "English";
-        case WordPackage::Polish: return "Polish";
-        default: return "English";
+    if (selected == "Off") {
+        setTypoTolerance(0);
+    } else if (selected == "1 Typo") {
+        setTypoTolerance(1);
+    } else if (selected == "2 Typos") {
+        setTypoTolerance(2);
     }
+    currentState = GameState::Settings;
 }
\ No newline at end of file
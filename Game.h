@@ -9,38 +9,57 @@
 #include <sstream>
 #include <algorithm>
 #include <random>
+#include <thread>
+#include <future>
+#include "Renderer.h"
 #include "components/Button.h"
 #include "components/Word.h"
+#include "components/SoundPool.h"
+#include "GameSession.h"
 #include "enums/GameState.h"
 #include "enums/Difficulty.h"
 #include "enums/WordPackage.h"
+#include "core/TripleBuffer.h"
+#include "core/FrameSnapshot.h"
+#include "core/InputQueue.h"
+#include "core/StartupProfiler.h"
+#include "core/FramePacer.h"
+#include "core/GameOptions.h"
+#include "core/GameMetrics.h"
+#include "core/MetricsExporter.h"
+#include "core/EventLog.h"
+#include "core/AllocationTracker.h"
 
 class Game {
 public:
-    Game();
-    auto run() -> void;
+    explicit Game(const GameOptions& options = {});
+    auto run() -> int;
 
 private:
+    auto startLoading() -> void;
+    auto isLoaded() const -> bool;
+    auto waitForLoading() -> void;
+    auto finishLoading() -> bool;
+    auto renderLoadingScreen() -> void;
     auto processEvents() -> void;
+    auto simulationLoop(std::stop_token stopToken) -> void;
+    auto handleEvent(const sf::Event& event) -> void;
     auto update() -> void;
-    auto render() -> void;
+    auto publishSnapshot() -> void;
+    auto publishMetrics() -> void;
+    auto logStateChange(const GameState& previousState) -> void;
+    auto checkRenderAllocations(const GameState& state) -> void;
+    auto checkSimulationAllocations(const GameState& previousState) -> void;
+    auto isAllocationGuardDone() -> bool;
+    auto render(const FrameSnapshot& snapshot) -> void;
     auto resetGame() -> void;
-    auto decreaseHealth() -> void;
+    auto startRound() -> void;
+    auto getActiveSession() -> GameSession&;
+    auto switchLane() -> void;
+    auto setTypoTolerance(const int& maxDistance) -> void;
+    auto checkGameOver() -> void;
     auto checkWord() -> void;
-    auto spawnWord() -> void;
 
-    auto renderMenuScreen() -> void;
-    auto renderGameScreen() -> void;
-    auto renderGameOverScreen() -> void;
-    auto renderPauseScreen() -> void;
-    auto renderSettingsScreen() -> void;
-    auto renderDifficultySettingsScreen() -> void;
-    auto renderWordPackageSettingsScreen() -> void;
-    auto renderFontSettingsScreen() -> void;
-    auto renderLeaderboardScreen() -> void;
-
-    auto loadBackground() -> void;
-    auto loadFont(const std::string& fontName) -> bool;
     auto loadWordPackage() -> void;
     auto loadLeaderboard() -> void;
     auto loadGame() -> bool;
@@ -48,13 +67,8 @@ private:
     auto saveGame() -> void;
     auto saveScore() -> void;
 
-    auto createButtons(std::vector<Button>& buttonsVector,
-                      const std::vector<std::string>& buttonTexts,
-                      const float& marginTop,
-                      const float& buttonWidth,
-                      const float& buttonHeight,
-                      const float& spacing) -> void;
-    auto updateAllTexts() -> void;
+    auto getLevelHash() const -> std::uint64_t;
+    auto getButtonText(const GameState& state, const int& index) -> const std::string&;
 
     auto handleMenuSelection(int index) -> void;
     auto handlePauseSelection(int index) -> void;
@@ -63,43 +77,60 @@ private:
     auto handleDifficultySelection(int index) -> void;
     auto handleWordPackageSelection(int index) -> void;
     auto handleFontSelection(int index) -> void;
+    auto handleFramePacingSelection(int index) -> void;
+    auto handleTypoToleranceSelection(int index) -> void;
+
+    static constexpr int allocationWarmupFrames = 60;
+    static constexpr int allocationGuardFrames = 300;
 
-    auto setupText(const std::string& content, 
-                  const int& size, 
-                  const sf::Color& color,
-                  const sf::Vector2f& position, 
-                  const bool& centerX = false) const -> sf::Text;
-    auto getWordSpeed() const -> float;
-    auto getSpawnInterval() const -> float;
-    auto getScoreMultiplier() const -> float;
-    auto getMaxHealth() const -> int;
-    auto getDifficultyString() const -> std::string;
-    auto getWordPackageString() const -> std::string;
+    StartupProfiler startupProfiler;
+    GameMetrics metrics;
+    MetricsExporter metricsExporter;
+    EventLog eventLog;
+    bool fontLoaded = false;
+    bool backgroundLoaded = false;
+    bool logoLoaded = false;
+    sf::Image backgroundImage;
+    sf::Image logoImage;
 
+    // Owned by the main thread: window and everything drawn into it.
     sf::RenderWindow renderWindow;
-    sf::Font font;
-    sf::Texture* backgroundTexture;
-    sf::Sprite* background;
-    std::vector<Button> menuButtons;
-    std::vector<Button> gameOverButtons;
-    std::vector<Button> settingsButtons;
-    std::vector<Button> pauseButtons;
-    std::vector<Button> difficultyButtons;
-    std::vector<Button> wordPackageButtons;
-    std::vector<Button> fontButtons;
-    std::vector<Word> words;
-    std::string currentInput;
-    int score;
+    Renderer renderer;
+    AllocationMonitor renderAllocations{"render", {AllocationPhase::Render}};
+    int renderFramesInGame = 0;
+    FramePacer framePacer;
+
+    // Shared between the threads: input goes one way, finished frames the other.
+    InputQueue inputQueue;
+    std::vector<QueuedEvent> pendingEvents;
+    TripleBuffer<FrameSnapshot> snapshots;
+    std::jthread simulationThread;
+    bool allocationGuard = false;
+    std::atomic<bool> allocationGuardFailed = false;
+    std::atomic<int> simulationSteadyTicks = 0;
+
+    // Owned by the simulation thread.
+    std::uint64_t tick = 0;
     GameState currentState;
-    std::chrono::steady_clock::time_point lastFrame;
-    std::chrono::steady_clock::time_point lastWordSpawn;
     std::vector<std::vector<std::string>> leaderboard;
     Difficulty currentDifficulty;
-    int health;
     std::vector<std::string> wordList;
+    std::u32string wordCharacters;
+    MarkovWordGenerator wordGenerator;
+    std::mt19937 seedGenerator{std::random_device()()};
+    std::vector<GameSession> sessions;
+    std::vector<LevelReader> levels;
+    int activeLane = 0;
+    std::uint32_t round = 0;
     WordPackage currentWordPackage;
-    std::string currentFont;
+    std::string selectedFont;
+    FramePacing selectedFramePacing;
     int selectedButtonIndex = 0;
-    sf::SoundBuffer* soundBuffer;
-    sf::Sound* sound;
+    std::vector<std::vector<std::string>> buttonLabels;
+    SoundPool sounds;
+    AllocationMonitor simulationAllocations{"simulation", {AllocationPhase::Input, AllocationPhase::Update, AllocationPhase::Snapshot}};
+    int ticksInGame = 0;
+
+    // Loading tasks write into the members above, declared last so they are joined before any of those is destroyed.
+    std::vector<std::future<void>> loadingTasks;
 }; 
\ No newline at end of file
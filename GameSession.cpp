@@ -0,0 +1,406 @@
+#include "GameSession.h"
+#include <algorithm>
+#include <cstdlib>
+
+static_assert(LevelFormat::ticksPerSecond == GameSession::tickRate);
+static_assert(LevelFormat::maxWordLength <= GameSession::textCapacity);
+
+GameSession::GameSession(const std::vector<std::string>& wordList,
+                         const Difficulty& difficulty,
+                         const unsigned int& seed,
+                         const float& fieldWidth)
+    : wordList(&wordList), difficulty(difficulty), fieldWidth(fieldWidth), generator(seed), words(maxWords, textCapacity), timers(maxTimers) {
+    //Words, input and generated text all fit these, so a round never grows a string
+    generatedWord.reserve(textCapacity);
+    levelEvent.word.reserve(textCapacity);
+    currentInput.reserve(textCapacity);
+    rebuildSelector();
+    reset(difficulty);
+}
+
+auto GameSession::reset(const Difficulty& difficulty) -> void {
+    this->difficulty = difficulty;
+    if (difficulty != selectorDifficulty) {
+        rebuildSelector();
+    }
+    words.clear();
+    currentInput.clear();
+    score = 0;
+    health = getMaxHealth();
+    tick = 0;
+    timers.reset(tick);
+    if (level) {
+        level->rewind();
+        levelFinished = false;
+        if (readLevelEvent()) {
+            timers.schedule(levelEvent.tick, ScheduledEvent::LevelSpawn);
+        }
+    } else {
+        scheduleSpawn();
+    }
+}
+
+auto GameSession::reseed(const unsigned int& seed) -> void {
+    generator.seed(seed);
+}
+
+auto GameSession::refreshWordList() -> void {
+    rebuildSelector();
+}
+
+auto GameSession::setWordGenerator(const MarkovWordGenerator* wordGenerator) -> void {
+    this->wordGenerator = wordGenerator;
+}
+
+auto GameSession::setLevel(LevelReader* level) -> void {
+    this->level = level && level->isOpen() ? level : nullptr;
+}
+
+auto GameSession::restore(const int& score,
+                          const int& health,
+                          const std::vector<Word>& words,
+                          const std::uint64_t& tick,
+                          const std::vector<ScheduledTimer>& timers) -> void {
+    this->score = score;
+    this->health = health;
+    this->words.clear();
+    for (const auto& word : words) {
+        auto position = word.getPosition();
+        this->words.spawn(word.getText(), position.x, position.y, word.getSpeed());
+    }
+    currentInput.clear();
+
+    this->tick = tick;
+    this->timers.reset(tick);
+    auto spawnScheduled = false;
+    for (const auto& timer : timers) {
+        //restoreLevel schedules the level's spawn from the reader, random spawns have no place in a level
+        if (timer.event == ScheduledEvent::LevelSpawn || (level && timer.event == ScheduledEvent::Spawn)) {
+            continue;
+        }
+        this->timers.schedule(timer.dueTick, timer.event);
+        spawnScheduled |= timer.event == ScheduledEvent::Spawn;
+    }
+    //Saves from before timers were stored still need words to keep coming
+    if (!level && !spawnScheduled) {
+        scheduleSpawn();
+    }
+}
+
+auto GameSession::restoreLevel(const std::optional<LevelPosition>& position) -> void {
+    if (!level) {
+        return;
+    }
+    levelFinished = !position || !level->seek(*position) || !readLevelEvent();
+    if (!levelFinished) {
+        timers.schedule(levelEvent.tick, ScheduledEvent::LevelSpawn);
+    }
+}
+
+auto GameSession::update() -> void {
+    if (isOver()) {
+        return;
+    }
+
+    tick++;
+    timers.advance(tick, [this](const ScheduledEvent& event) { fire(event); });
+
+    //Walk backwards so despawning, which swaps the last live word into place, never skips one
+    for (auto i = static_cast<int>(words.size()) - 1; i >= 0; i--) {
+        auto& word = words.at(i);
+        word.update();
+
+        if (word.isOffScreen(fieldWidth)) {
+            decreaseHealth();
+            logEvent(GameEventType::Damage, word.getText(), static_cast<float>(health));
+            words.despawn(words.handleAt(i));
+        }
+    }
+}
+
+auto GameSession::typeCharacter(const char& c) -> void {
+    currentInput += c;
+}
+
+auto GameSession::backspace() -> void {
+    if (!currentInput.empty()) {
+        currentInput.pop_back();
+    }
+}
+
+auto GameSession::submit() -> SubmitResult {
+    if (currentInput.empty()) {
+        return SubmitResult::Empty;
+    }
+
+    auto iterator = std::find_if(words.begin(), words.end(),
+        [this](const Word& word) {return word.getText() == currentInput;});
+
+    if (iterator != words.end()) {
+        logEvent(GameEventType::Hit, iterator->getText(), getSecondsOnScreen(*iterator), 0.0f);
+        currentInput.clear();
+        words.despawn(iterator.handle());
+        score += 10 * getScoreMultiplier();
+        return SubmitResult::Hit;
+    }
+
+    if (typoTolerance > 0) {
+        auto distance = 0;
+        auto closest = findClosestWord(distance);
+        if (closest != words.end()) {
+            logEvent(GameEventType::Hit, closest->getText(), getSecondsOnScreen(*closest), static_cast<float>(distance));
+            currentInput.clear();
+            words.despawn(closest.handle());
+            score += 10 * getScoreMultiplier() / (1 + distance);
+            return SubmitResult::NearHit;
+        }
+    }
+
+    logEvent(GameEventType::Miss, currentInput);
+    currentInput.clear();
+    decreaseHealth();
+    logEvent(GameEventType::Damage, {}, static_cast<float>(health));
+    return SubmitResult::Miss;
+}
+
+auto GameSession::setTypoTolerance(const int& maxDistance) -> void {
+    typoTolerance = std::max(0, maxDistance);
+}
+
+auto GameSession::getTypoTolerance() const -> int {
+    return typoTolerance;
+}
+
+auto GameSession::setEventLog(EventLog* eventLog, const std::uint32_t& sessionId) -> void {
+    this->eventLog = eventLog;
+    this->sessionId = sessionId;
+}
+
+auto GameSession::logEvent(const GameEventType& type, const std::string_view& word, const float& value0, const float& value1) -> void {
+    if (eventLog) {
+        eventLog->log(type, sessionId, tick, word, value0, value1);
+    }
+}
+
+auto GameSession::getSecondsOnScreen(const Word& word) const -> float {
+    //Words enter at x = 0 and move at a constant speed, so the distance covered is the time alive
+    return word.getPosition().x / word.getSpeed() / tickRate;
+}
+
+auto GameSession::findClosestWord(int& distance) -> WordPool::Iterator {
+    auto closest = words.end();
+    if (!matcher.setPattern(currentInput)) {
+        return closest;
+    }
+
+    //Ties go to the word closest to the edge, that is the one the player most likely meant
+    distance = typoTolerance + 1;
+    for (auto iterator = words.begin(); iterator != words.end(); ++iterator) {
+        const auto& text = iterator->getText();
+        auto lengthDifference = static_cast<int>(text.size()) - static_cast<int>(currentInput.size());
+        if (std::abs(lengthDifference) > typoTolerance) {
+            continue;
+        }
+
+        auto candidate = matcher.distance(text);
+        if (candidate < distance || (candidate == distance && closest != words.end()
+                                     && iterator->getPosition().x > closest->getPosition().x)) {
+            distance = candidate;
+            closest = iterator;
+        }
+    }
+    return closest;
+}
+
+auto GameSession::isOver() const -> bool {
+    return health <= 0 || isLevelComplete();
+}
+
+auto GameSession::isLevelComplete() const -> bool {
+    return level && levelFinished && words.size() == 0;
+}
+
+auto GameSession::getLevelPosition() const -> std::optional<LevelPosition> {
+    if (!level || levelFinished) {
+        return std::nullopt;
+    }
+    return levelEventPosition;
+}
+
+auto GameSession::getScore() const -> int {
+    return score;
+}
+
+auto GameSession::getHealth() const -> int {
+    return health;
+}
+
+auto GameSession::getDifficulty() const -> Difficulty {
+    return difficulty;
+}
+
+auto GameSession::getWords() const -> const WordPool& {
+    return words;
+}
+
+auto GameSession::getCurrentInput() const -> const std::string& {
+    return currentInput;
+}
+
+auto GameSession::getTick() const -> std::uint64_t {
+    return tick;
+}
+
+auto GameSession::getSpawnCount() const -> std::uint64_t {
+    return spawnCount;
+}
+
+auto GameSession::getTimers() const -> std::vector<ScheduledTimer> {
+    auto pending = std::vector<ScheduledTimer>();
+    timers.forEach([&pending](const std::uint64_t& dueTick, const ScheduledEvent& event) {
+        pending.push_back({event, dueTick});
+    });
+    return pending;
+}
+
+auto GameSession::getFieldWidth() const -> float {
+    return fieldWidth;
+}
+
+auto GameSession::spawnWord() -> void {
+    if (wordList->empty()) {
+        return;
+    }
+
+    //https://stackoverflow.com/questions/7560114/random-number-c-in-some-range
+    std::uniform_int_distribution<> y(50, 500);
+    float yDist = y(generator);
+
+    spawnWord(pickWord(), yDist, getWordSpeed());
+}
+
+auto GameSession::spawnWord(const std::string& text, const float& y, const float& speed) -> void {
+    if (text.empty()) {
+        return;
+    }
+
+    if (words.spawn(text, 0, y, speed)) {
+        spawnCount++;
+        logEvent(GameEventType::Spawn, text, y, speed);
+    }
+}
+
+auto GameSession::readLevelEvent() -> bool {
+    //Only the next event of the level is held, the reader fetches each one as the previous comes due
+    levelEventPosition = level->getPosition();
+    levelFinished = !level->next(levelEvent);
+    return !levelFinished;
+}
+
+auto GameSession::spawnLevelEvents() -> void {
+    //Events due on the same tick spawn together instead of each waiting a tick for its timer
+    do {
+        auto y = 50.0f + (levelEvent.row < 0 ? std::uniform_int_distribution<>(0, 450)(generator) : levelEvent.row * 50.0f);
+        if (!levelEvent.word.empty()) {
+            spawnWord(levelEvent.word, y, levelEvent.speed);
+        } else if (!wordList->empty()) {
+            spawnWord(pickWord(), y, levelEvent.speed);
+        }
+    } while (readLevelEvent() && levelEvent.tick <= tick);
+
+    if (!levelFinished) {
+        timers.schedule(levelEvent.tick, ScheduledEvent::LevelSpawn);
+    }
+}
+
+auto GameSession::pickWord() -> const std::string& {
+    if (wordGenerator && !wordGenerator->empty()) {
+        wordGenerator->generate(generator, getMinWordLength(), getMaxWordLength(), generatedWord);
+        return generatedWord;
+    }
+
+    return (*wordList)[selector.next(generator)];
+}
+
+auto GameSession::rebuildSelector() -> void {
+    //The weights only depend on the list and the difficulty. Building them allocates, so it happens
+    //when either changes rather than on the first spawn of a round
+    selector.rebuild(*wordList, difficulty);
+    selectorDifficulty = difficulty;
+}
+
+auto GameSession::scheduleSpawn() -> void {
+    timers.schedule(tick + static_cast<std::uint64_t>(getSpawnInterval() * tickRate), ScheduledEvent::Spawn);
+}
+
+auto GameSession::fire(const ScheduledEvent& event) -> void {
+    switch (event) {
+        case ScheduledEvent::Spawn:
+            spawnWord();
+            scheduleSpawn();
+            break;
+        case ScheduledEvent::LevelSpawn:
+            if (level && !levelFinished) {
+                spawnLevelEvents();
+            }
+            break;
+    }
+}
+
+auto GameSession::decreaseHealth() -> void {
+    health--;
+}
+
+auto GameSession::getWordSpeed() const -> float {
+    switch (difficulty) {
+        case Difficulty::Easy: return 2.0f;
+        case Difficulty::Medium: return 3.0f;
+        case Difficulty::Hard: return 4.0f;
+        default: return 2.0f;
+    }
+}
+
+auto GameSession::getSpawnInterval() const -> float {
+    switch (difficulty) {
+        case Difficulty::Easy: return 2.0f;
+        case Difficulty::Medium: return 1.5f;
+        case Difficulty::Hard: return 1.0f;
+        default: return 2.0f;
+    }
+}
+
+auto GameSession::getScoreMultiplier() const -> float {
+    switch (difficulty) {
+        case Difficulty::Easy: return 1.0f;
+        case Difficulty::Medium: return 1.3f;
+        case Difficulty::Hard: return 1.5f;
+        default: return 1.0f;
+    }
+}
+
+auto GameSession::getMaxHealth() const -> int {
+    switch (difficulty) {
+        case Difficulty::Easy: return 3;
+        case Difficulty::Medium: return 2;
+        case Difficulty::Hard: return 1;
+        default: return 3;
+    }
+}
+
+auto GameSession::getMinWordLength() const -> int {
+    switch (difficulty) {
+        case Difficulty::Easy: return 4;
+        case Difficulty::Medium: return 5;
+        case Difficulty::Hard: return 7;
+        default: return 4;
+    }
+}
+
+auto GameSession::getMaxWordLength() const -> int {
+    switch (difficulty) {
+        case Difficulty::Easy: return 6;
+        case Difficulty::Medium: return 8;
+        case Difficulty::Hard: return 11;
+        default: return 6;
+    }
+}
\ No newline at end of file
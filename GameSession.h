@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+#include "components/Word.h"
+#include "components/WordPool.h"
+#include "enums/Difficulty.h"
+#include "enums/SubmitResult.h"
+#include "core/BitParallelMatcher.h"
+#include "core/EventLog.h"
+#include "core/TimerWheel.h"
+#include "core/WordSelector.h"
+#include "core/MarkovWordGenerator.h"
+#include "core/LevelReader.h"
+#include "enums/ScheduledEvent.h"
+
+struct ScheduledTimer {
+    ScheduledEvent event;
+    std::uint64_t dueTick;
+};
+
+// Rules of a single round: spawning, moving and matching words, score and health.
+// It knows nothing about windows, fonts or sounds, so it can run headless.
+// The tick only advances in update(), so it is a game clock that stands still while the
+// player is paused or in a menu; timed gameplay events are scheduled against it.
+// With a level set, spawns come from its timeline instead of the difficulty's fixed interval
+// and the round is also over once the level has run out and its last word is gone.
+class GameSession {
+public:
+    static constexpr int tickRate = 60;
+    static constexpr std::size_t maxWords = 256;
+    static constexpr std::size_t maxTimers = 64;
+    static constexpr std::size_t textCapacity = 32;
+
+    GameSession(const std::vector<std::string>& wordList, const Difficulty& difficulty, const unsigned int& seed, const float& fieldWidth);
+
+    auto reset(const Difficulty& difficulty) -> void;
+    auto reseed(const unsigned int& seed) -> void;
+    auto refreshWordList() -> void;
+    auto setWordGenerator(const MarkovWordGenerator* wordGenerator) -> void;
+    auto setLevel(LevelReader* level) -> void;
+    auto restore(const int& score,
+                 const int& health,
+                 const std::vector<Word>& words,
+                 const std::uint64_t& tick,
+                 const std::vector<ScheduledTimer>& timers) -> void;
+    auto restoreLevel(const std::optional<LevelPosition>& position) -> void;
+    auto update() -> void;
+
+    auto typeCharacter(const char& c) -> void;
+    auto backspace() -> void;
+    auto submit() -> SubmitResult;
+    auto setTypoTolerance(const int& maxDistance) -> void;
+    auto getTypoTolerance() const -> int;
+    auto setEventLog(EventLog* eventLog, const std::uint32_t& sessionId) -> void;
+
+    auto isOver() const -> bool;
+    auto isLevelComplete() const -> bool;
+    auto getLevelPosition() const -> std::optional<LevelPosition>;
+    auto getScore() const -> int;
+    auto getHealth() const -> int;
+    auto getDifficulty() const -> Difficulty;
+    auto getWords() const -> const WordPool&;
+    auto getCurrentInput() const -> const std::string&;
+    auto getTick() const -> std::uint64_t;
+    auto getSpawnCount() const -> std::uint64_t;
+    auto getTimers() const -> std::vector<ScheduledTimer>;
+    auto getFieldWidth() const -> float;
+
+    auto getWordSpeed() const -> float;
+    auto getSpawnInterval() const -> float;
+    auto getScoreMultiplier() const -> float;
+    auto getMaxHealth() const -> int;
+    auto getMinWordLength() const -> int;
+    auto getMaxWordLength() const -> int;
+
+private:
+    auto spawnWord() -> void;
+    auto spawnWord(const std::string& text, const float& y, const float& speed) -> void;
+    auto readLevelEvent() -> bool;
+    auto spawnLevelEvents() -> void;
+    auto pickWord() -> const std::string&;
+    auto rebuildSelector() -> void;
+    auto scheduleSpawn() -> void;
+    auto fire(const ScheduledEvent& event) -> void;
+    auto decreaseHealth() -> void;
+    auto logEvent(const GameEventType& type, const std::string_view& word = {}, const float& value0 = 0.0f, const float& value1 = 0.0f) -> void;
+    auto getSecondsOnScreen(const Word& word) const -> float;
+    auto findClosestWord(int& distance) -> WordPool::Iterator;
+
+    const std::vector<std::string>* wordList;
+    Difficulty difficulty;
+    float fieldWidth;
+    std::mt19937 generator;
+    WordPool words;
+    TimerWheel<ScheduledEvent> timers;
+    WordSelector selector;
+    Difficulty selectorDifficulty = Difficulty::Easy;
+    const MarkovWordGenerator* wordGenerator = nullptr;
+    std::string generatedWord;
+    LevelReader* level = nullptr;
+    LevelEvent levelEvent;
+    LevelPosition levelEventPosition;
+    bool levelFinished = false;
+    std::string currentInput;
+    int score = 0;
+    int health = 0;
+    std::uint64_t tick = 0;
+    std::uint64_t spawnCount = 0;
+    int typoTolerance = 0;
+    BitParallelMatcher matcher;
+    EventLog* eventLog = nullptr;
+    std::uint32_t sessionId = 0;
+};
@@ -0,0 +1,630 @@
+#include "Renderer.h"
+#include <array>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fmt/format.h>
+#include "core/Assets.h"
+
+namespace {
+    //Every character size used by setupText, the buttons and the word texts
+    constexpr std::array<unsigned int, 4> textSizes = {20, 24, 30, 60};
+
+    //Formats into a caller owned buffer instead of a new std::string, long results are cut off
+    template <typename... Args>
+    auto formatInto(std::array<char, 64>& buffer, fmt::format_string<Args...> format, Args&&... args) -> std::string_view {
+        auto result = fmt::format_to_n(buffer.data(), buffer.size(), format, std::forward<Args>(args)...);
+        return {buffer.data(), std::min(result.size, buffer.size())};
+    }
+}
+
+Renderer::Renderer(const sf::Vector2u& size, const int& wordCapacity, const int& laneCount) : layoutSize(size) {
+    //Lanes only own their texts, the font with its glyph pages and the textures are shared by all of them
+    lanes.reserve(laneCount);
+    for (auto i = 0; i < laneCount; i++) {
+        lanes.push_back(createLane(wordCapacity));
+    }
+}
+
+auto Renderer::createLane(const int& wordCapacity) -> LaneTexts {
+    auto lane = LaneTexts{{}, {}, {font, "", 24}, {font, "", 24}, {font, "", 24}, {font, "", 24}};
+
+    //One text per word slot, its geometry is only rebuilt when the slot gets a new word
+    lane.wordTexts.reserve(wordCapacity);
+    for (auto i = 0; i < wordCapacity; i++) {
+        lane.wordTexts.emplace_back(font, "", 30);
+        lane.wordTexts.back().setOutlineThickness(2);
+    }
+    lane.wordTextGenerations.assign(wordCapacity, 0);
+
+    lane.inputText.setFillColor(sf::Color::Green);
+    lane.inputText.setPosition({10, 550});
+    lane.scoreText.setFillColor(sf::Color::White);
+    lane.scoreText.setPosition({650, 550});
+    lane.healthText.setFillColor(sf::Color::Red);
+    lane.healthText.setPosition({10, 20});
+    lane.difficultyText.setFillColor(sf::Color::Yellow);
+    lane.difficultyText.setPosition({650, 20});
+    for (auto* text : {&lane.inputText, &lane.scoreText, &lane.healthText, &lane.difficultyText}) {
+        text->setOutlineThickness(2);
+    }
+    return lane;
+}
+
+auto Renderer::loadFont(const std::string& fontName) -> bool {
+    //https://www.sfml-dev.org/tutorials/3.0/graphics/text/
+    if (Assets::loadFont(font, "fonts/" + fontName)) {
+        currentFont = fontName;
+        requestedFont = fontName;
+        return true;
+    }
+    return false;
+}
+
+auto Renderer::loadTextures(const sf::Image& backgroundImage, const sf::Image& logoImage) -> bool {
+    //https://www.youtube.com/watch?v=tXfdP3pcppI
+    backgroundTexture = new sf::Texture();
+    if (backgroundTexture->loadFromImage(backgroundImage)) {
+        background = new sf::Sprite(*backgroundTexture);
+
+        auto textureSize = backgroundTexture->getSize();
+
+        //https://www.geeksforgeeks.org/casting-operators-in-cpp/
+        float scaleX = static_cast<float>(layoutSize.x) / textureSize.x;
+        float scaleY = static_cast<float>(layoutSize.y) / textureSize.y;
+        auto scale = std::max(scaleX, scaleY);
+
+        background->setScale({scale, scale});
+    }
+
+    //An empty logo would be scaled by its zero width, the menu leaves it out instead
+    logoLoaded = logoTexture.loadFromImage(logoImage);
+    return background && logoLoaded;
+}
+
+auto Renderer::setFrameStats(const FrameStats& stats) -> void {
+    frameStats = stats;
+}
+
+auto Renderer::render(sf::RenderTarget& target, const FrameSnapshot& snapshot) -> void {
+    drawCalls = 0;
+
+    if (snapshot.font != requestedFont) {
+        requestedFont = snapshot.font;
+        if (loadFont(requestedFont)) {
+            updateAllTexts();
+            warmGlyphs(snapshot.wordCharacters);
+            resetTextGeometry();
+        }
+    }
+    if (snapshot.wordCharacters != warmedCharacters) {
+        warmGlyphs(snapshot.wordCharacters);
+    }
+
+    if (auto currentButtons = getButtons(snapshot.state)) {
+        for (auto i = 0; i < currentButtons->size(); i++) {
+            auto& button = (*currentButtons)[i];
+            button.setSelected(i == snapshot.selectedButtonIndex);
+        }
+    }
+
+    target.clear(sf::Color(30, 30, 30));
+
+    if (background) {
+        draw(target, *background);
+    }
+
+    switch (snapshot.state) {
+        case GameState::Menu:
+            renderMenuScreen(target, snapshot);
+            break;
+        case GameState::Game:
+            renderGameScreen(target, snapshot);
+            break;
+        case GameState::Pause:
+            renderPauseScreen(target, snapshot);
+            break;
+        case GameState::GameOver:
+            renderGameOverScreen(target, snapshot);
+            break;
+        case GameState::Settings:
+            renderSettingsScreen(target, snapshot);
+            break;
+        case GameState::SettingsDifficulty:
+            renderDifficultySettingsScreen(target, snapshot);
+            break;
+        case GameState::SettingsWordPackage:
+            renderWordPackageSettingsScreen(target, snapshot);
+            break;
+        case GameState::SettingsFont:
+            renderFontSettingsScreen(target, snapshot);
+            break;
+        case GameState::SettingsFramePacing:
+            renderFramePacingSettingsScreen(target, snapshot);
+            break;
+        case GameState::SettingsTypoTolerance:
+            renderTypoToleranceSettingsScreen(target, snapshot);
+            break;
+        case GameState::Leaderboard:
+            renderLeaderboardScreen(target, snapshot);
+            break;
+    }
+}
+
+auto Renderer::renderLoadingScreen(sf::RenderTarget& target, const float& progress) -> void {
+    drawCalls = 0;
+
+    auto barSize = sf::Vector2f(400, 20);
+    auto barPosition = sf::Vector2f((layoutSize.x - barSize.x) / 2, (layoutSize.y - barSize.y) / 2);
+
+    sf::RectangleShape frame(barSize);
+    frame.setPosition(barPosition);
+    frame.setFillColor(sf::Color(45, 45, 45));
+    frame.setOutlineThickness(2);
+    frame.setOutlineColor(sf::Color(100, 100, 100));
+
+    sf::RectangleShape bar(sf::Vector2f(barSize.x * progress, barSize.y));
+    bar.setPosition(barPosition);
+    bar.setFillColor(sf::Color(0, 120, 0));
+
+    target.clear(sf::Color(30, 30, 30));
+    draw(target, frame);
+    draw(target, bar);
+}
+
+auto Renderer::createAllButtons(const unsigned int& targetFps) -> void {
+    auto buttonWidth = 200.0f;
+    auto buttonHeight = 50.0f;
+    auto buttonSpacing = 20.0f;
+
+    createButtons(menuButtons,
+                  getButtonLabels(GameState::Menu, targetFps),
+                  200, buttonWidth, buttonHeight, buttonSpacing);
+
+    createButtons(gameOverButtons,
+                  getButtonLabels(GameState::GameOver, targetFps),
+                  300, buttonWidth, buttonHeight, buttonSpacing);
+
+    createButtons(pauseButtons,
+                  getButtonLabels(GameState::Pause, targetFps),
+                  200, buttonWidth, buttonHeight, buttonSpacing);
+
+    createButtons(settingsButtons,
+                  getButtonLabels(GameState::Settings, targetFps),
+                  170, buttonWidth, buttonHeight, 12);
+
+    createButtons(difficultyButtons,
+                  getButtonLabels(GameState::SettingsDifficulty, targetFps),
+                  200, buttonWidth, buttonHeight, buttonSpacing);
+
+    createButtons(wordPackageButtons,
+                  getButtonLabels(GameState::SettingsWordPackage, targetFps),
+                  200, buttonWidth, buttonHeight, buttonSpacing);
+
+    createButtons(fontButtons,
+                  getButtonLabels(GameState::SettingsFont, targetFps),
+                  200, buttonWidth, buttonHeight, buttonSpacing);
+
+    createButtons(framePacingButtons,
+                  getButtonLabels(GameState::SettingsFramePacing, targetFps),
+                  200, buttonWidth, buttonHeight, buttonSpacing);
+
+    createButtons(typoToleranceButtons,
+                  getButtonLabels(GameState::SettingsTypoTolerance, targetFps),
+                  200, buttonWidth, buttonHeight, buttonSpacing);
+}
+
+auto Renderer::warmGlyphs(const std::u32string& characters) -> void {
+    //Glyphs are rasterized on first use, which means FreeType work and a texture upload in the middle of a frame.
+    //Requesting every glyph we can draw now keeps that out of gameplay, font changes clear the cache so this runs again.
+    //https://www.sfml-dev.org/documentation/3.0.0/classsf_1_1Font.html
+    auto start = std::chrono::steady_clock::now();
+    auto glyphs = 0;
+    auto atlasPixels = std::int64_t(0);
+    auto warm = [this, &glyphs, &atlasPixels](const char32_t& c, const unsigned int& characterSize, const float& outlineThickness) {
+        const auto& glyph = font.getGlyph(c, characterSize, false, outlineThickness);
+        atlasPixels += static_cast<std::int64_t>(glyph.textureRect.size.x) * glyph.textureRect.size.y;
+        glyphs++;
+    };
+    for (const auto& characterSize : textSizes) {
+        for (auto outlineThickness : {0.0f, 2.0f}) {
+            for (auto c = U' '; c <= U'~'; c++) {
+                warm(c, characterSize, outlineThickness);
+            }
+            for (auto c : characters) {
+                warm(c, characterSize, outlineThickness);
+            }
+        }
+    }
+    warmedCharacters = characters;
+
+    auto took = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    fmt::print(stderr, "[glyphs] warmed {} glyphs of {} ({} KiB of atlas) in {:.1f} ms\n", glyphs, currentFont, atlasPixels * 4 / 1024, took);
+}
+
+auto Renderer::resetTextGeometry() -> void {
+    //Texts cache their geometry until the string changes, which a font switch does not do. Building it
+    //once from a long string also sizes the vertex arrays so later words and scores never grow them.
+    const auto longest = std::string(32, 'W');
+    auto resetText = [this, &longest](sf::Text& text) {
+        setTextString(text, longest);
+        //Asking for the bounds is what makes the text build its geometry
+        (void)text.getLocalBounds();
+        setTextString(text, {});
+    };
+
+    for (auto& lane : lanes) {
+        for (auto& text : lane.wordTexts) {
+            resetText(text);
+        }
+        for (auto* text : {&lane.inputText, &lane.scoreText, &lane.healthText, &lane.difficultyText}) {
+            resetText(*text);
+        }
+        lane.wordTextGenerations.assign(lane.wordTexts.size(), 0);
+    }
+}
+
+auto Renderer::setTextString(sf::Text& text, const std::string_view& content) -> void {
+    //Converting a std::string to sf::String builds a temporary, widening into a reused one does not allocate
+    textScratch.clear();
+    for (auto c : content) {
+        textScratch += sf::String(static_cast<char32_t>(static_cast<unsigned char>(c)));
+    }
+    text.setString(textScratch);
+}
+
+auto Renderer::getCurrentFont() const -> const std::string& {
+    return currentFont;
+}
+
+auto Renderer::getDrawCalls() const -> int {
+    return drawCalls;
+}
+
+auto Renderer::renderMenuScreen(sf::RenderTarget& target, const FrameSnapshot& snapshot) -> void {
+    if (logoLoaded) {
+        auto logoImage = sf::Sprite(logoTexture);
+
+        auto const textureSize = logoTexture.getSize();
+        auto const width = 300.0f;
+        auto const scale = width / textureSize.x;
+        logoImage.setScale({scale, scale});
+
+        logoImage.setPosition({(layoutSize.x - logoImage.getGlobalBounds().size.x) / 2, 10});
+        draw(target, logoImage);
+    }
+
+    drawButtons(target, menuButtons);
+}
+
+auto Renderer::renderGameScreen(sf::RenderTarget& target, const FrameSnapshot& snapshot) -> void {
+    auto laneCount = static_cast<int>(std::min(snapshot.lanes.size(), lanes.size()));
+    if (laneCount == 1) {
+        renderLane(target, snapshot, 0);
+        return;
+    }
+
+    //Every lane is laid out at full size and scaled into its own viewport
+    auto view = sf::View(sf::FloatRect({0, 0}, sf::Vector2f(layoutSize)));
+    for (auto i = 0; i < laneCount; i++) {
+        view.setViewport(getLaneViewport(i, laneCount));
+        target.setView(view);
+        renderLane(target, snapshot, i);
+    }
+    target.setView(target.getDefaultView());
+
+    for (auto i = 0; i < laneCount; i++) {
+        auto viewport = getLaneViewport(i, laneCount);
+        auto frame = sf::RectangleShape({viewport.size.x * layoutSize.x, viewport.size.y * layoutSize.y});
+        frame.setPosition({viewport.position.x * layoutSize.x, viewport.position.y * layoutSize.y});
+        frame.setFillColor(snapshot.lanes[i].over ? sf::Color(0, 0, 0, 150) : sf::Color::Transparent);
+        frame.setOutlineThickness(2);
+        frame.setOutlineColor(i == snapshot.activeLane ? sf::Color::Yellow : sf::Color(100, 100, 100));
+        draw(target, frame);
+    }
+}
+
+auto Renderer::renderLane(sf::RenderTarget& target, const FrameSnapshot& snapshot, const int& laneIndex) -> void {
+    const auto& lane = snapshot.lanes[laneIndex];
+    auto& texts = lanes[laneIndex];
+    for (const auto& word : lane.words) {
+        auto& text = texts.wordTexts[word.handle.index];
+        if (texts.wordTextGenerations[word.handle.index] != word.handle.generation) {
+            setTextString(text, word.text);
+            texts.wordTextGenerations[word.handle.index] = word.handle.generation;
+        }
+        text.setPosition(word.position);
+        text.setFillColor(Word::getColor(word.position, layoutSize.x));
+        draw(target, text);
+    }
+
+    //The HUD keeps its texts between frames, they only rebuild their geometry when the content changes
+    auto buffer = std::array<char, 64>();
+    setTextString(texts.inputText, lane.currentInput);
+    setTextString(texts.scoreText, formatInto(buffer, "Score: {}", lane.score));
+    setTextString(texts.healthText, formatInto(buffer, "Health: {}", lane.health));
+    setTextString(texts.difficultyText, formatInto(buffer, "Difficulty: {}", getDifficultyString(snapshot.difficulty)));
+    for (const auto* text : {&texts.inputText, &texts.scoreText, &texts.healthText, &texts.difficultyText}) {
+        draw(target, *text);
+    }
+}
+
+auto Renderer::getLaneViewport(const int& index, const int& count) -> sf::FloatRect {
+    //Lanes fill a grid of equal cells, each shrunk to the layout's aspect ratio so nothing is stretched
+    auto columns = static_cast<int>(std::ceil(std::sqrt(static_cast<float>(count))));
+    auto rows = (count + columns - 1) / columns;
+    auto scale = 1.0f / std::max(columns, rows);
+    auto cellWidth = 1.0f / columns;
+    auto cellHeight = 1.0f / rows;
+
+    auto column = index % columns;
+    auto row = index / columns;
+    return {{column * cellWidth + (cellWidth - scale) / 2, row * cellHeight + (cellHeight - scale) / 2}, {scale, scale}};
+}
+
+auto Renderer::renderGameOverScreen(sf::RenderTarget& target, const FrameSnapshot& snapshot) -> void {
+    //The level only counts as complete when every lane cleared it, the scores below say which ones did
+    auto levelComplete = !snapshot.lanes.empty() && std::all_of(snapshot.lanes.begin(), snapshot.lanes.end(), [](const LaneSnapshot& lane) {
+        return lane.levelComplete;
+    });
+    if (levelComplete) {
+        draw(target, setupText("Level Complete!", 60, sf::Color::Green, sf::Vector2f(0, 150), true));
+    } else {
+        draw(target, setupText("Game Over!", 60, sf::Color::Red, sf::Vector2f(0, 150), true));
+    }
+    if (snapshot.lanes.size() == 1) {
+        draw(target, setupText(fmt::format("Achieved score: {}", snapshot.lanes[0].score), 30, sf::Color::White, sf::Vector2f(0, 220), true));
+    } else {
+        auto scores = std::string("Scores:");
+        for (auto i = 0; i < snapshot.lanes.size(); i++) {
+            scores += fmt::format(" {}{}{}", i == 0 ? "" : "| ", snapshot.lanes[i].score, snapshot.lanes[i].levelComplete ? " cleared" : "");
+        }
+        draw(target, setupText(scores, 30, sf::Color::White, sf::Vector2f(0, 220), true));
+    }
+
+    drawButtons(target, gameOverButtons);
+}
+
+auto Renderer::renderPauseScreen(sf::RenderTarget& target, const FrameSnapshot& snapshot) -> void {
+    renderGameScreen(target, snapshot);
+
+    sf::RectangleShape darkenLayer(sf::Vector2f(800, 600));
+    darkenLayer.setFillColor(sf::Color(0, 0, 0, 150));
+    draw(target, darkenLayer);
+
+    draw(target, setupText("Game Paused", 60, sf::Color::White, sf::Vector2f(0, 100), true));
+
+    drawButtons(target, pauseButtons);
+}
+
+auto Renderer::renderSettingsScreen(sf::RenderTarget& target, const FrameSnapshot& snapshot) -> void {
+    draw(target, setupText("Settings", 60, sf::Color::White, sf::Vector2f(0, 100), true));
+
+    drawButtons(target, settingsButtons);
+
+    draw(target, setupText(
+        fmt::format("Current: {}, {}, {}", getDifficultyString(snapshot.difficulty), getWordPackageString(snapshot.wordPackage),
+                    getFramePacingString(snapshot.framePacing)),
+        24, sf::Color::Yellow, sf::Vector2f(0, 540), true
+    ));
+}
+
+auto Renderer::renderDifficultySettingsScreen(sf::RenderTarget& target, const FrameSnapshot& snapshot) -> void {
+    draw(target, setupText("Select Difficulty", 60, sf::Color::White, sf::Vector2f(0, 100), true));
+
+    drawButtons(target, difficultyButtons);
+
+    draw(target, setupText(
+        "Easy: 3 health, slow speed, multiplier 1x\n"
+        "Medium: 2 health, medium speed, multiplier 1.3x\n"
+        "Hard: 1 health, fast speed, multiplier 1.5x",
+        20, sf::Color::Yellow, sf::Vector2f(0, 475), true
+    ));
+}
+
+auto Renderer::renderWordPackageSettingsScreen(sf::RenderTarget& target, const FrameSnapshot& snapshot) -> void {
+    draw(target, setupText("Select Word Package", 60, sf::Color::White, sf::Vector2f(0, 100), true));
+
+    drawButtons(target, wordPackageButtons);
+}
+
+auto Renderer::renderFontSettingsScreen(sf::RenderTarget& target, const FrameSnapshot& snapshot) -> void {
+    draw(target, setupText("Select Font", 60, sf::Color::White, sf::Vector2f(0, 100), true));
+
+    drawButtons(target, fontButtons);
+
+    draw(target, setupText(
+        fmt::format("Current: {}", currentFont),
+        24, sf::Color::Yellow, sf::Vector2f(0, 475), true
+    ));
+}
+
+auto Renderer::renderFramePacingSettingsScreen(sf::RenderTarget& target, const FrameSnapshot& snapshot) -> void {
+    draw(target, setupText("Frame Pacing", 60, sf::Color::White, sf::Vector2f(0, 100), true));
+
+    drawButtons(target, framePacingButtons);
+
+    draw(target, setupText(
+        fmt::format("Current: {}\nFrame time: {:.2f} ms avg, {:.2f} ms std dev, {:.2f}-{:.2f} ms",
+                    getFramePacingString(snapshot.framePacing), frameStats.meanMs, frameStats.stdDevMs, frameStats.minMs, frameStats.maxMs),
+        20, sf::Color::Yellow, sf::Vector2f(0, 475), true
+    ));
+}
+
+auto Renderer::renderTypoToleranceSettingsScreen(sf::RenderTarget& target, const FrameSnapshot& snapshot) -> void {
+    draw(target, setupText("Typo Tolerance", 60, sf::Color::White, sf::Vector2f(0, 100), true));
+
+    drawButtons(target, typoToleranceButtons);
+
+    draw(target, setupText(
+        fmt::format("Current: {}\nA word with up to that many typos still counts, for fewer points",
+                    snapshot.typoTolerance == 0 ? std::string("Off") : std::to_string(snapshot.typoTolerance)),
+        20, sf::Color::Yellow, sf::Vector2f(0, 475), true
+    ));
+}
+
+auto Renderer::renderLeaderboardScreen(sf::RenderTarget& target, const FrameSnapshot& snapshot) -> void {
+    draw(target, setupText("Leaderboard", 60, sf::Color::White, sf::Vector2f(0, 50), true));
+    draw(target, setupText("Rank", 24, sf::Color::Yellow, sf::Vector2f(100, 120)));
+    draw(target, setupText("Score", 24, sf::Color::Yellow, sf::Vector2f(250, 120)));
+    draw(target, setupText("Date", 24, sf::Color::Yellow, sf::Vector2f(400, 120)));
+
+    auto yPosition = 170.0f;
+    auto spacing = 40.0f;
+    for (auto i = 0; i < 10 && i < snapshot.leaderboard.size(); i++) {
+        const auto& entry = snapshot.leaderboard[i];
+        draw(target, setupText(std::to_string(i + 1), 24, sf::Color::White, {100, yPosition}));
+        draw(target, setupText(entry[0], 24, sf::Color::White, {250, yPosition}));
+        draw(target, setupText(entry[1], 24, sf::Color::White, {400, yPosition}));
+        yPosition += spacing;
+    }
+
+    draw(target, setupText("Press ESC to return to menu", 20, sf::Color(200, 200, 200), sf::Vector2f(0, 550), true));
+}
+
+auto Renderer::draw(sf::RenderTarget& target, const sf::Drawable& drawable) -> void {
+    target.draw(drawable);
+    drawCalls++;
+}
+
+//Texts and shapes draw their outline as a separate primitive, and a text without glyphs draws nothing
+//https://www.sfml-dev.org/documentation/3.0.0/classsf_1_1Text.html
+auto Renderer::draw(sf::RenderTarget& target, const sf::Text& text) -> void {
+    target.draw(text);
+    if (!text.getString().isEmpty()) {
+        drawCalls += text.getOutlineThickness() != 0 ? 2 : 1;
+    }
+}
+
+auto Renderer::draw(sf::RenderTarget& target, const sf::Shape& shape) -> void {
+    target.draw(shape);
+    drawCalls += shape.getOutlineThickness() != 0 ? 2 : 1;
+}
+
+auto Renderer::drawButtons(sf::RenderTarget& target, const std::vector<Button>& buttons) -> void {
+    Button::drawButtons(buttons, target);
+    //Every button is its outlined rectangle, a fill and an outline call, and its plain text
+    drawCalls += 3 * static_cast<int>(buttons.size());
+}
+
+auto Renderer::createButtons(std::vector<Button>& buttonsVector,
+                        const std::vector<std::string>& buttonTexts,
+                        const float& marginTop,
+                        const float& buttonWidth,
+                        const float& buttonHeight,
+                        const float& spacing) -> void {
+    for (auto i = 0; i < buttonTexts.size(); i++) {
+        buttonsVector.push_back(
+            {
+                {(layoutSize.x - buttonWidth) / 2, marginTop + i * (buttonHeight + spacing)},
+                {buttonWidth, buttonHeight},
+                buttonTexts[i],
+                font
+            }
+        );
+    }
+}
+
+auto Renderer::updateAllTexts() -> void {
+    auto allButtons = std::vector<std::vector<Button>*>{
+        &menuButtons, &settingsButtons, &difficultyButtons,
+        &wordPackageButtons, &fontButtons, &framePacingButtons, &typoToleranceButtons, &gameOverButtons, &pauseButtons
+    };
+    Button::updateAllButtons(allButtons, font);
+}
+
+auto Renderer::getButtonLabels(const GameState& state, const unsigned int& targetFps) -> std::vector<std::string> {
+    switch (state) {
+        case GameState::Menu:
+            return {"Play", "Settings", "Leaderboard", "Load Game"};
+        case GameState::Pause:
+            return {"Continue", "Save Game", "Main Menu"};
+        case GameState::GameOver:
+            return {"Play Again", "Main Menu"};
+        case GameState::Settings:
+            return {"Difficulty", "Word Package", "Font", "Frame Pacing", "Typo Tolerance", "Back to Menu"};
+        case GameState::SettingsDifficulty:
+            return {"Easy", "Medium", "Hard", "Back"};
+        case GameState::SettingsWordPackage:
+            return {"English Words", "Polish Words", "Generated Words", "Back"};
+        case GameState::SettingsFont:
+            return {"Arial", "Calibri", "Consolas", "Back"};
+        case GameState::SettingsFramePacing:
+            return {"VSync", fmt::format("Capped {} FPS", targetFps), "Uncapped", "Back"};
+        case GameState::SettingsTypoTolerance:
+            return {"Off", "1 Typo", "2 Typos", "Back"};
+        default:
+            return {};
+    }
+}
+
+auto Renderer::getButtons(const GameState& state) -> std::vector<Button>* {
+    switch (state) {
+        case GameState::Menu:
+            return &menuButtons;
+        case GameState::Pause:
+            return &pauseButtons;
+        case GameState::GameOver:
+            return &gameOverButtons;
+        case GameState::Settings:
+            return &settingsButtons;
+        case GameState::SettingsDifficulty:
+            return &difficultyButtons;
+        case GameState::SettingsWordPackage:
+            return &wordPackageButtons;
+        case GameState::SettingsFont:
+            return &fontButtons;
+        case GameState::SettingsFramePacing:
+            return &framePacingButtons;
+        case GameState::SettingsTypoTolerance:
+            return &typoToleranceButtons;
+        default:
+            return nullptr;
+    }
+}
+
+auto Renderer::setupText(const std::string& content, 
+                    const int& size, 
+                    const sf::Color& color,
+                    const sf::Vector2f& position, 
+                    const bool& centerX) const -> sf::Text {
+    sf::Text textObj(font, content, size);
+    textObj.setFillColor(color);
+    textObj.setOutlineThickness(2);
+
+    if (centerX) {
+        auto bounds = textObj.getLocalBounds();
+        textObj.setPosition({(layoutSize.x - bounds.size.x) / 2, position.y});
+    } else {
+        textObj.setPosition(position);
+    }
+
+    return textObj;
+}
+
+auto Renderer::getDifficultyString(const Difficulty& difficulty) -> std::string {
+    switch (difficulty) {
+        case Difficulty::Easy: return "Easy";
+        case Difficulty::Medium: return "Medium";
+        case Difficulty::Hard: return "Hard";
+        default: return "Easy";
+    }
+}
+
+auto Renderer::getWordPackageString(const WordPackage& wordPackage) -> std::string {
+    switch (wordPackage) {
+        case WordPackage::English: return "English";
+        case WordPackage::Polish: return "Polish";
+        case WordPackage::Generated: return "Generated";
+        default: return "English";
+    }
+}
+
+auto Renderer::getFramePacingString(const FramePacing& framePacing) -> std::string {
+    switch (framePacing) {
+        case FramePacing::VSync: return "VSync";
+        case FramePacing::Capped: return "Capped";
+        case FramePacing::Uncapped: return "Uncapped";
+        default: return "Capped";
+    }
+}
\ No newline at end of file
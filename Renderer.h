@@ -0,0 +1,107 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "components/Button.h"
+#include "components/Word.h"
+#include "enums/GameState.h"
+#include "enums/Difficulty.h"
+#include "enums/WordPackage.h"
+#include "enums/FramePacing.h"
+#include "core/FrameSnapshot.h"
+#include "core/FramePacer.h"
+
+// Draws frame snapshots into any render target, the window in the game and a render texture
+// in the benchmark. Owns the font, textures, texts and buttons, so it belongs to the thread that
+// renders; other threads take button labels from getButtonLabels, never from the buttons.
+class Renderer {
+public:
+    Renderer(const sf::Vector2u& size, const int& wordCapacity, const int& laneCount = 1);
+
+    auto loadFont(const std::string& fontName) -> bool;
+    auto loadTextures(const sf::Image& backgroundImage, const sf::Image& logoImage) -> bool;
+    auto createAllButtons(const unsigned int& targetFps) -> void;
+    auto warmGlyphs(const std::u32string& characters) -> void;
+    auto resetTextGeometry() -> void;
+    auto setFrameStats(const FrameStats& stats) -> void;
+    auto render(sf::RenderTarget& target, const FrameSnapshot& snapshot) -> void;
+    auto renderLoadingScreen(sf::RenderTarget& target, const float& progress) -> void;
+
+    auto getButtons(const GameState& state) -> std::vector<Button>*;
+    static auto getButtonLabels(const GameState& state, const unsigned int& targetFps) -> std::vector<std::string>;
+    auto getCurrentFont() const -> const std::string&;
+    auto getDrawCalls() const -> int;
+
+private:
+    // Per lane state, cheap next to the font and textures every lane draws with.
+    struct LaneTexts {
+        std::vector<sf::Text> wordTexts;
+        std::vector<std::uint32_t> wordTextGenerations;
+        sf::Text inputText;
+        sf::Text scoreText;
+        sf::Text healthText;
+        sf::Text difficultyText;
+    };
+
+    auto createLane(const int& wordCapacity) -> LaneTexts;
+    auto renderMenuScreen(sf::RenderTarget& target, const FrameSnapshot& snapshot) -> void;
+    auto renderGameScreen(sf::RenderTarget& target, const FrameSnapshot& snapshot) -> void;
+    auto renderLane(sf::RenderTarget& target, const FrameSnapshot& snapshot, const int& laneIndex) -> void;
+    auto renderGameOverScreen(sf::RenderTarget& target, const FrameSnapshot& snapshot) -> void;
+    auto renderPauseScreen(sf::RenderTarget& target, const FrameSnapshot& snapshot) -> void;
+    auto renderSettingsScreen(sf::RenderTarget& target, const FrameSnapshot& snapshot) -> void;
+    auto renderDifficultySettingsScreen(sf::RenderTarget& target, const FrameSnapshot& snapshot) -> void;
+    auto renderWordPackageSettingsScreen(sf::RenderTarget& target, const FrameSnapshot& snapshot) -> void;
+    auto renderFontSettingsScreen(sf::RenderTarget& target, const FrameSnapshot& snapshot) -> void;
+    auto renderFramePacingSettingsScreen(sf::RenderTarget& target, const FrameSnapshot& snapshot) -> void;
+    auto renderTypoToleranceSettingsScreen(sf::RenderTarget& target, const FrameSnapshot& snapshot) -> void;
+    auto renderLeaderboardScreen(sf::RenderTarget& target, const FrameSnapshot& snapshot) -> void;
+
+    auto draw(sf::RenderTarget& target, const sf::Drawable& drawable) -> void;
+    auto draw(sf::RenderTarget& target, const sf::Text& text) -> void;
+    auto draw(sf::RenderTarget& target, const sf::Shape& shape) -> void;
+    auto drawButtons(sf::RenderTarget& target, const std::vector<Button>& buttons) -> void;
+    auto createButtons(std::vector<Button>& buttonsVector,
+                      const std::vector<std::string>& buttonTexts,
+                      const float& marginTop,
+                      const float& buttonWidth,
+                      const float& buttonHeight,
+                      const float& spacing) -> void;
+    auto updateAllTexts() -> void;
+    auto setTextString(sf::Text& text, const std::string_view& content) -> void;
+    auto setupText(const std::string& content,
+                  const int& size,
+                  const sf::Color& color,
+                  const sf::Vector2f& position,
+                  const bool& centerX = false) const -> sf::Text;
+    static auto getLaneViewport(const int& index, const int& count) -> sf::FloatRect;
+    static auto getDifficultyString(const Difficulty& difficulty) -> std::string;
+    static auto getWordPackageString(const WordPackage& wordPackage) -> std::string;
+    static auto getFramePacingString(const FramePacing& framePacing) -> std::string;
+
+    sf::Vector2u layoutSize;
+    sf::Font font;
+    std::string currentFont;
+    std::string requestedFont;
+    std::u32string warmedCharacters;
+    std::vector<LaneTexts> lanes;
+    sf::String textScratch;
+    sf::Texture* backgroundTexture = nullptr;
+    sf::Sprite* background = nullptr;
+    sf::Texture logoTexture;
+    bool logoLoaded = false;
+    FrameStats frameStats;
+    int drawCalls = 0;
+    std::vector<Button> menuButtons;
+    std::vector<Button> gameOverButtons;
+    std::vector<Button> settingsButtons;
+    std::vector<Button> pauseButtons;
+    std::vector<Button> difficultyButtons;
+    std::vector<Button> wordPackageButtons;
+    std::vector<Button> fontButtons;
+    std::vector<Button> framePacingButtons;
+    std::vector<Button> typoToleranceButtons;
+};
\ No newline at end of file
@@ -0,0 +1,320 @@
+#include <SFML/Graphics.hpp>
+#include <SFML/OpenGL.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+#include "../Renderer.h"
+#include "../core/Assets.h"
+
+// Renders scripted scenes into an offscreen texture and diffs them against golden images. Runs on a
+// headless Linux box with Mesa's software rasterizer, from the directory holding assets/, e.g.
+// xvfb-run -a env LIBGL_ALWAYS_SOFTWARE=1 monkeytyper_render_bench --frames=600 --golden=golden
+// Without --golden the scenes are only timed. The images in bench/golden come from the update_render_golden
+// target, ctest runs the comparison as render_golden and a missing image fails it.
+
+struct Options {
+    int frames = 300;
+    int warmupFrames = 30;
+    std::vector<std::string> scenes = {"menu", "words10", "words100", "words1000", "pause", "leaderboard", "split4"};
+    std::string golden;
+    std::string output;
+    bool updateGolden = false;
+    int tolerance = 8;
+    double maxDifferingFraction = 0.001;
+};
+
+struct Scene {
+    std::string name;
+    FrameSnapshot snapshot;
+    std::vector<std::vector<float>> speeds;
+};
+
+struct SceneResult {
+    std::string name;
+    double msPerFrame = 0;
+    double cpuMsPerFrame = 0;
+    int drawCalls = 0;
+    std::string golden = "skipped";
+    double differingFraction = 0;
+};
+
+constexpr auto windowSize = sf::Vector2u(800, 600);
+constexpr int wordCapacity = 1000;
+constexpr int laneCount = 4;
+
+auto split(const std::string& value) -> std::vector<std::string> {
+    auto parts = std::vector<std::string>();
+    auto stream = std::istringstream(value);
+    auto part = std::string();
+    while (std::getline(stream, part, ',')) {
+        parts.push_back(part);
+    }
+    return parts;
+}
+
+auto parseOptions(int argc, char** argv) -> Options {
+    auto options = Options();
+    for (auto i = 1; i < argc; i++) {
+        auto argument = std::string(argv[i]);
+        auto separator = argument.find('=');
+        auto key = argument.substr(0, separator);
+        auto value = separator == std::string::npos ? std::string() : argument.substr(separator + 1);
+
+        if (key == "--frames") options.frames = std::stoi(value);
+        else if (key == "--warmup") options.warmupFrames = std::stoi(value);
+        else if (key == "--scenes") options.scenes = split(value);
+        else if (key == "--golden") options.golden = value;
+        else if (key == "--output") options.output = value;
+        else if (key == "--update-golden") options.updateGolden = true;
+        else if (key == "--tolerance") options.tolerance = std::stoi(value);
+        else if (key == "--max-diff") options.maxDifferingFraction = std::stod(value);
+        else throw std::invalid_argument("unknown option: " + key);
+    }
+    if (options.updateGolden && options.golden.empty()) {
+        throw std::invalid_argument("--update-golden needs --golden=DIR");
+    }
+    return options;
+}
+
+auto makeLanes(Scene& scene, const std::vector<std::string>& wordList, const int& lanes, const int& count) -> void {
+    //A fixed seed keeps the first frame identical between runs, so it can be compared to a golden image
+    auto random = std::mt19937(1);
+    auto x = std::uniform_real_distribution<float>(-50.0f, 700.0f);
+    auto y = std::uniform_real_distribution<float>(40.0f, 500.0f);
+    auto speed = std::uniform_real_distribution<float>(0.5f, 3.0f);
+
+    scene.snapshot.lanes.resize(lanes);
+    scene.speeds.resize(lanes);
+    for (auto lane = 0; lane < lanes; lane++) {
+        auto& snapshot = scene.snapshot.lanes[lane];
+        snapshot.currentInput = "monk";
+        snapshot.score = 1234 - lane * 100;
+        snapshot.health = 2;
+        for (auto i = 0; i < count; i++) {
+            auto handle = WordHandle{static_cast<std::uint32_t>(i), 1};
+            snapshot.words.push_back({handle, wordList[(i + lane) % wordList.size()], {x(random), y(random)}});
+            scene.speeds[lane].push_back(speed(random));
+        }
+    }
+}
+
+auto makeScene(const std::string& name, const std::vector<std::string>& wordList, const std::string& font) -> Scene {
+    auto scene = Scene{name};
+    auto& snapshot = scene.snapshot;
+    snapshot.font = font;
+    snapshot.difficulty = Difficulty::Medium;
+
+    if (name == "menu") {
+        snapshot.state = GameState::Menu;
+    } else if (name.starts_with("words")) {
+        snapshot.state = GameState::Game;
+        auto count = std::stoi(name.substr(5));
+        if (count > wordCapacity) {
+            throw std::invalid_argument(fmt::format("scene {} has more than {} words", name, wordCapacity));
+        }
+        makeLanes(scene, wordList, 1, count);
+    } else if (name == "pause") {
+        snapshot.state = GameState::Pause;
+        snapshot.selectedButtonIndex = 1;
+        makeLanes(scene, wordList, 1, 100);
+    } else if (name == "leaderboard") {
+        snapshot.state = GameState::Leaderboard;
+        for (auto i = 0; i < 10; i++) {
+            snapshot.leaderboard.push_back({std::to_string(5000 - i * 350), fmt::format("2025-01-{:02} 12:00", i + 1)});
+        }
+    } else if (name == "split4") {
+        snapshot.state = GameState::Game;
+        snapshot.activeLane = 1;
+        makeLanes(scene, wordList, laneCount, 50);
+        scene.snapshot.lanes[3].over = true;
+    } else {
+        throw std::invalid_argument("unknown scene: " + name);
+    }
+    return scene;
+}
+
+//Moves the words like the simulation would, wrapping them around so every frame has the same load
+auto advance(Scene& scene) -> void {
+    for (auto lane = 0; lane < scene.snapshot.lanes.size(); lane++) {
+        auto& words = scene.snapshot.lanes[lane].words;
+        for (auto i = 0; i < words.size(); i++) {
+            auto& position = words[i].position;
+            position.x += scene.speeds[lane][i];
+            if (position.x > windowSize.x) {
+                position.x = -100.0f;
+            }
+        }
+    }
+}
+
+//Counts pixels where any channel is further apart than the tolerance and marks them red in the diff image
+auto diffImages(const sf::Image& actual, const sf::Image& expected, const int& tolerance, sf::Image& diff) -> double {
+    auto size = actual.getSize();
+    if (expected.getSize() != size) {
+        return 1.0;
+    }
+
+    diff = sf::Image(size, sf::Color::Black);
+    const auto* a = actual.getPixelsPtr();
+    const auto* b = expected.getPixelsPtr();
+    auto differing = std::size_t(0);
+    for (auto y = 0u; y < size.y; y++) {
+        for (auto x = 0u; x < size.x; x++) {
+            auto offset = (static_cast<std::size_t>(y) * size.x + x) * 4;
+            auto differs = false;
+            for (auto channel = 0; channel < 4; channel++) {
+                differs |= std::abs(a[offset + channel] - b[offset + channel]) > tolerance;
+            }
+            if (differs) {
+                differing++;
+                diff.setPixel({x, y}, sf::Color::Red);
+            } else {
+                diff.setPixel({x, y}, sf::Color(a[offset] / 4, a[offset + 1] / 4, a[offset + 2] / 4));
+            }
+        }
+    }
+    return static_cast<double>(differing) / (static_cast<std::size_t>(size.x) * size.y);
+}
+
+auto checkGolden(const Options& options, const std::string& name, const sf::Image& frame, SceneResult& result) -> void {
+    auto outputPath = std::filesystem::path(options.output) / (name + ".png");
+    if (!options.output.empty() && !frame.saveToFile(outputPath)) {
+        fmt::print(stderr, "Could not write {}\n", outputPath.string());
+    }
+    if (options.golden.empty()) {
+        return;
+    }
+
+    auto goldenPath = std::filesystem::path(options.golden) / (name + ".png");
+    if (options.updateGolden) {
+        result.golden = frame.saveToFile(goldenPath) ? "updated" : "error";
+        return;
+    }
+
+    auto expected = sf::Image();
+    if (!std::filesystem::exists(goldenPath) || !expected.loadFromFile(goldenPath)) {
+        result.golden = "missing";
+        return;
+    }
+
+    auto diff = sf::Image();
+    result.differingFraction = diffImages(frame, expected, options.tolerance, diff);
+    result.golden = result.differingFraction <= options.maxDifferingFraction ? "pass" : "fail";
+    auto diffPath = std::filesystem::path(options.output) / (name + ".diff.png");
+    if (result.golden == "fail" && !options.output.empty() && !diff.saveToFile(diffPath)) {
+        fmt::print(stderr, "Could not write {}\n", diffPath.string());
+    }
+}
+
+auto runScene(const Options& options, Renderer& renderer, sf::RenderTexture& texture, Scene& scene) -> SceneResult {
+    auto result = SceneResult{scene.name};
+
+    //The first frame is the one compared, before any word has moved
+    renderer.render(texture, scene.snapshot);
+    texture.display();
+    result.drawCalls = renderer.getDrawCalls();
+    checkGolden(options, scene.name, texture.getTexture().copyToImage(), result);
+
+    for (auto i = 0; i < options.warmupFrames; i++) {
+        advance(scene);
+        renderer.render(texture, scene.snapshot);
+        texture.display();
+    }
+
+    //glFinish on both ends makes the wall time include the GPU work, not just the submission
+    if (!texture.setActive(true)) {
+        throw std::runtime_error("could not activate the render texture");
+    }
+    glFinish();
+    auto cpuSeconds = 0.0;
+    auto start = std::chrono::steady_clock::now();
+    for (auto i = 0; i < options.frames; i++) {
+        advance(scene);
+        auto submitStart = std::chrono::steady_clock::now();
+        renderer.render(texture, scene.snapshot);
+        texture.display();
+        cpuSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - submitStart).count();
+    }
+    glFinish();
+    auto wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    result.msPerFrame = wallSeconds * 1000.0 / options.frames;
+    result.cpuMsPerFrame = cpuSeconds * 1000.0 / options.frames;
+    return result;
+}
+
+int main(int argc, char** argv) {
+    auto options = Options();
+    try {
+        options = parseOptions(argc, argv);
+    } catch (const std::exception& e) {
+        fmt::print(stderr, "{}\n", e.what());
+        return 1;
+    }
+
+    //The render texture brings its own context, which the font and textures below need
+    auto texture = sf::RenderTexture();
+    if (!texture.resize(windowSize)) {
+        fmt::print(stderr, "Could not create a {}x{} render texture\n", windowSize.x, windowSize.y);
+        return 1;
+    }
+
+    auto renderer = Renderer(windowSize, wordCapacity, laneCount);
+    auto backgroundImage = sf::Image();
+    auto logoImage = sf::Image();
+    auto text = std::string();
+    if (!renderer.loadFont("arial.ttf") || !Assets::loadImage(backgroundImage, "background.png") ||
+        !Assets::loadImage(logoImage, "logo.png") || !Assets::readText("packages/words_english.txt", text)) {
+        fmt::print(stderr, "Could not load the assets, run from the directory holding assets/\n");
+        return 1;
+    }
+
+    auto wordList = std::vector<std::string>();
+    auto stream = std::istringstream(text);
+    for (auto word = std::string(); stream >> word;) {
+        wordList.push_back(word);
+    }
+
+    if (!renderer.loadTextures(backgroundImage, logoImage)) {
+        fmt::print(stderr, "Could not upload the background and logo textures\n");
+        return 1;
+    }
+    renderer.createAllButtons(60);
+    renderer.warmGlyphs({});
+    renderer.resetTextGeometry();
+
+    if (!options.output.empty()) {
+        std::filesystem::create_directories(options.output);
+    }
+    if (options.updateGolden) {
+        std::filesystem::create_directories(options.golden);
+    }
+
+    auto results = std::vector<SceneResult>();
+    try {
+        for (const auto& name : options.scenes) {
+            auto scene = makeScene(name, wordList, renderer.getCurrentFont());
+            results.push_back(runScene(options, renderer, texture, scene));
+        }
+    } catch (const std::exception& e) {
+        fmt::print(stderr, "{}\n", e.what());
+        return 1;
+    }
+
+    fmt::print(std::cout, "scene,frames,ms_per_frame,cpu_ms_per_frame,draw_calls,golden,differing_fraction\n");
+    auto failed = false;
+    for (const auto& result : results) {
+        fmt::print(std::cout, "{},{},{:.3f},{:.3f},{},{},{:.5f}\n", result.name, options.frames, result.msPerFrame,
+                   result.cpuMsPerFrame, result.drawCalls, result.golden, result.differingFraction);
+        failed |= result.golden == "fail" || result.golden == "missing" || result.golden == "error";
+    }
+    return failed ? 1 : 0;
+}
\ No newline at end of file
@@ -0,0 +1,25 @@
+# Turns the listed asset files into a C++ source file with one byte array per asset.
+# Run in script mode:
+#   cmake -DASSET_DIR=<dir> -DASSETS=<a,b,c> -DOUTPUT=<file.cpp> -P EmbedAssets.cmake
+
+string(REPLACE "," ";" ASSET_LIST "${ASSETS}")
+
+set(SOURCE "// Generated by cmake/EmbedAssets.cmake, do not edit.\n#include \"core/EmbeddedAssets.h\"\n\n")
+set(TABLE "")
+set(INDEX 0)
+
+foreach(ASSET IN LISTS ASSET_LIST)
+    file(READ "${ASSET_DIR}/${ASSET}" HEX HEX)
+    file(SIZE "${ASSET_DIR}/${ASSET}" SIZE)
+    string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," BYTES "${HEX}")
+    string(APPEND SOURCE "alignas(16) static const unsigned char asset${INDEX}[] = {${BYTES}};\n")
+    string(APPEND TABLE "    {\"${ASSET}\", asset${INDEX}, ${SIZE}},\n")
+    math(EXPR INDEX "${INDEX} + 1")
+endforeach()
+
+string(APPEND SOURCE "\nconst EmbeddedAsset embeddedAssets[] = {\n${TABLE}};\n\n")
+string(APPEND SOURCE "const std::size_t embeddedAssetCount = ${INDEX};\n")
+
+file(WRITE "${OUTPUT}.tmp" "${SOURCE}")
+file(COPY_FILE "${OUTPUT}.tmp" "${OUTPUT}" ONLY_IF_DIFFERENT)
+file(REMOVE "${OUTPUT}.tmp")
@@ -9,7 +9,10 @@ Button::Button(const sf::Vector2f& position, const sf::Vector2f& size, const std
     rectangle.setOutlineColor(sf::Color(100, 100, 100));
 
     text.setFillColor(sf::Color(220, 220, 220));
+    centerText();
+}
 
+auto Button::centerText() -> void {
     //https://stackoverflow.com/questions/67523148/centering-text-on-top-of-buttons-in-sfml
     text.setPosition(
         {position.x + (size.x - text.getGlobalBounds().size.x) / 2,
@@ -17,9 +20,9 @@ Button::Button(const sf::Vector2f& position, const sf::Vector2f& size, const std
     );
 }
 
-auto Button::draw(sf::RenderWindow& window) const -> void {
-    window.draw(rectangle);
-    window.draw(text);
+auto Button::draw(sf::RenderTarget& target) const -> void {
+    target.draw(rectangle);
+    target.draw(text);
 }
 
 auto Button::setSelected(bool selected) -> void {
@@ -39,17 +42,22 @@ auto Button::getText() const -> std::string{
     return text.getString();
 }
 
-auto Button::updateAllButtons(std::vector<std::vector<Button>>& buttonsVectors, const sf::Font& font) -> void {
-    for (auto& buttonsVector : buttonsVectors) {
-        for (auto& button : buttonsVector) {
+auto Button::updateAllButtons(const std::vector<std::vector<Button>*>& buttonsVectors, const sf::Font& font) -> void {
+    for (auto* buttonsVector : buttonsVectors) {
+        for (auto& button : *buttonsVector) {
+            //The same font object is reloaded in place, so the text has to be rebuilt and centered again
+            auto content = button.text.getString();
             button.text.setFont(font);
+            button.text.setString("");
+            button.text.setString(content);
+            button.centerText();
         }
     }
 }
 
-auto Button::drawButtons(const std::vector<Button>& buttons, sf::RenderWindow& renderWindow) -> void {
+auto Button::drawButtons(const std::vector<Button>& buttons, sf::RenderTarget& target) -> void {
     for (const auto& button : buttons) {
-        button.draw(renderWindow);
+        button.draw(target);
     }
 }
 
@@ -7,13 +7,15 @@
 class Button {
 public:
     Button(const sf::Vector2f& position, const sf::Vector2f& size, const std::string& textStr, const sf::Font& font);
-    auto draw(sf::RenderWindow& window) const -> void;
+    auto draw(sf::RenderTarget& target) const -> void;
     auto setSelected(bool selected) -> void;
     auto getText() const -> std::string;
-    static auto updateAllButtons(std::vector<std::vector<Button>>& buttonsVectors, const sf::Font& font) -> void;
-    static auto drawButtons(const std::vector<Button>& buttons, sf::RenderWindow& renderWindow) -> void;
+    static auto updateAllButtons(const std::vector<std::vector<Button>*>& buttonsVectors, const sf::Font& font) -> void;
+    static auto drawButtons(const std::vector<Button>& buttons, sf::RenderTarget& target) -> void;
     auto getPosition() const -> sf::Vector2f;
 private:
+    auto centerText() -> void;
+
     sf::RectangleShape rectangle;
     sf::Text text;
     sf::Vector2f position;
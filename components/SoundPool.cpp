@@ -0,0 +1,88 @@
+#include "SoundPool.h"
+#include "../core/Assets.h"
+#include <cmath>
+#include <numbers>
+
+SoundPool::SoundPool(const std::size_t& voicesPerCue, const float& volume)
+    : voicesPerCue(voicesPerCue), volume(volume) {}
+
+auto SoundPool::loadCue(const SoundCue& cue, const std::string& path) -> bool {
+    auto& cueVoices = cues[static_cast<int>(cue)];
+    if (!Assets::loadSoundBuffer(cueVoices.buffer, path)) {
+        return false;
+    }
+
+    createVoices(cueVoices);
+    return true;
+}
+
+auto SoundPool::synthesizeCue(const SoundCue& cue,
+                              const float& startFrequency,
+                              const float& endFrequency,
+                              const float& seconds) -> bool {
+    //Short sine sweep with a linear fade out, enough for feedback blips without shipping more assets
+    const auto sampleRate = 44100u;
+    const auto sampleCount = static_cast<std::size_t>(sampleRate * seconds);
+    auto samples = std::vector<std::int16_t>(sampleCount);
+
+    auto phase = 0.0;
+    for (auto i = 0; i < sampleCount; i++) {
+        auto progress = static_cast<double>(i) / sampleCount;
+        auto frequency = startFrequency + (endFrequency - startFrequency) * progress;
+        phase += 2.0 * std::numbers::pi * frequency / sampleRate;
+        samples[i] = static_cast<std::int16_t>(std::sin(phase) * (1.0 - progress) * 12000.0);
+    }
+
+    auto& cueVoices = cues[static_cast<int>(cue)];
+    if (!cueVoices.buffer.loadFromSamples(samples.data(), samples.size(), 1, sampleRate, {sf::SoundChannel::Mono})) {
+        return false;
+    }
+
+    createVoices(cueVoices);
+    return true;
+}
+
+auto SoundPool::play(const SoundCue& cue) -> void {
+    auto& cueVoices = cues[static_cast<int>(cue)];
+    auto& voices = cueVoices.voices;
+    if (voices.empty()) {
+        return;
+    }
+
+    auto selected = cueVoices.next;
+    auto oldest = cueVoices.next;
+    auto found = false;
+    for (auto i = 0; i < voices.size(); i++) {
+        auto index = (cueVoices.next + i) % voices.size();
+        if (voices[index].getStatus() == sf::SoundSource::Status::Stopped) {
+            selected = index;
+            found = true;
+            break;
+        }
+        if (cueVoices.startedAt[index] < cueVoices.startedAt[oldest]) {
+            oldest = index;
+        }
+    }
+
+    if (!found) {
+        selected = oldest;
+        voices[selected].stop();
+    }
+
+    voices[selected].play();
+    cueVoices.startedAt[selected] = ++playCounter;
+    cueVoices.next = (selected + 1) % voices.size();
+}
+
+auto SoundPool::createVoices(Voices& cueVoices) -> void {
+    if (!cueVoices.voices.empty()) {
+        return;
+    }
+
+    cueVoices.voices.reserve(voicesPerCue);
+    for (auto i = 0; i < voicesPerCue; i++) {
+        cueVoices.voices.emplace_back(cueVoices.buffer);
+        cueVoices.voices.back().setVolume(volume);
+    }
+    cueVoices.startedAt.assign(voicesPerCue, 0);
+}
\ No newline at end of file
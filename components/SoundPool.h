@@ -0,0 +1,37 @@
+#pragma once
+
+#include <SFML/Audio.hpp>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../enums/SoundCue.h"
+
+// Preallocated voices per cue, all bound to buffers decoded once at startup.
+// Playing a cue picks a free voice round-robin or restarts the oldest one, so
+// rapid repeats overlap instead of cutting each other off.
+class SoundPool {
+public:
+    explicit SoundPool(const std::size_t& voicesPerCue = 4, const float& volume = 50.0f);
+    SoundPool(const SoundPool&) = delete;
+    auto operator=(const SoundPool&) -> SoundPool& = delete;
+
+    auto loadCue(const SoundCue& cue, const std::string& path) -> bool;
+    auto synthesizeCue(const SoundCue& cue, const float& startFrequency, const float& endFrequency, const float& seconds) -> bool;
+    auto play(const SoundCue& cue) -> void;
+
+private:
+    struct Voices {
+        sf::SoundBuffer buffer;
+        std::vector<sf::Sound> voices;
+        std::vector<std::uint64_t> startedAt;
+        std::size_t next = 0;
+    };
+
+    auto createVoices(Voices& cueVoices) -> void;
+
+    std::size_t voicesPerCue;
+    float volume;
+    std::uint64_t playCounter = 0;
+    std::array<Voices, 3> cues;
+};
@@ -1,42 +1,45 @@
 #include "Word.h"
 
-Word::Word(const std::string& text, float x, float y, float speed, const sf::Font& font)
-    : speed(speed), textObj(font, text, 30) {
-    textObj.setPosition({x, y});
-    textObj.setOutlineThickness(2);
-}
+Word::Word(const std::string& text, float x, float y, float speed)
+    : text(text), position(x, y), speed(speed) {}
 
-auto Word::draw(sf::RenderWindow& window) -> void{
-    auto screenPercentage = textObj.getPosition().x / window.getSize().x;
-    if (screenPercentage >= 0.75) {
-        textObj.setFillColor(sf::Color::Red);
-    } else if (screenPercentage >= 0.50) {
-        textObj.setFillColor(sf::Color::Yellow);
-    } else {
-        textObj.setFillColor(sf::Color::Green);
-    }
+auto Word::reset(const std::string& text, float x, float y, float speed) -> void {
+    this->text.assign(text);
+    position = {x, y};
+    this->speed = speed;
+}
 
-    window.draw(textObj);
+auto Word::reserveText(const std::size_t& capacity) -> void {
+    text.reserve(capacity);
 }
 
 auto Word::update() -> void{
-    auto pos = textObj.getPosition();
-    pos.x += speed;
-    textObj.setPosition(pos);
+    position.x += speed;
 }
 
 auto Word::isOffScreen(const int& width) const -> bool {
-    return textObj.getPosition().x > width;
+    return position.x > width;
 }
 
-auto Word::getText() const -> std::string {
-    return textObj.getString().toAnsiString();
+auto Word::getText() const -> const std::string& {
+    return text;
 }
 
 auto Word::getPosition() const -> sf::Vector2f {
-    return textObj.getPosition();
+    return position;
 }
 
 auto Word::getSpeed() const -> float {
     return speed;
+}
+
+auto Word::getColor(const sf::Vector2f& position, const unsigned int& windowWidth) -> sf::Color {
+    auto screenPercentage = position.x / windowWidth;
+    if (screenPercentage >= 0.75) {
+        return sf::Color::Red;
+    }
+    if (screenPercentage >= 0.50) {
+        return sf::Color::Yellow;
+    }
+    return sf::Color::Green;
 }
\ No newline at end of file
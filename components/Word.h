@@ -5,14 +5,17 @@
 
 class Word {
 public:
-    Word(const std::string& text, float x, float y, float speed, const sf::Font& font);
+    Word(const std::string& text, float x, float y, float speed);
+    auto reset(const std::string& text, float x, float y, float speed) -> void;
+    auto reserveText(const std::size_t& capacity) -> void;
     auto update() -> void;
-    auto draw(sf::RenderWindow& window) -> void;
     auto isOffScreen(const int& width) const -> bool;
-    auto getText() const -> std::string;
+    auto getText() const -> const std::string&;
     auto getPosition() const -> sf::Vector2f;
     auto getSpeed() const -> float;
+    static auto getColor(const sf::Vector2f& position, const unsigned int& windowWidth) -> sf::Color;
 private:
+    std::string text;
+    sf::Vector2f position;
     float speed;
-    sf::Text textObj;
-}; 
\ No newline at end of file
+};  
\ No newline at end of file
@@ -0,0 +1,97 @@
+#include "WordPool.h"
+
+WordPool::WordPool(const std::size_t& capacity, const std::size_t& textCapacity) {
+    slots.reserve(capacity);
+    freeList.reserve(capacity);
+    live.reserve(capacity);
+
+    //Every slot's text is sized for the longest word up front, so spawning one only ever copies into it
+    for (auto i = 0; i < capacity; i++) {
+        slots.push_back({{"", 0, 0, 0}});
+        slots.back().word.reserveText(textCapacity);
+        freeList.push_back(static_cast<std::uint32_t>(capacity - 1 - i));
+    }
+}
+
+auto WordPool::spawn(const std::string& text, float x, float y, float speed) -> bool {
+    if (freeList.empty()) {
+        return false;
+    }
+
+    auto index = freeList.back();
+    freeList.pop_back();
+
+    auto& slot = slots[index];
+    slot.word.reset(text, x, y, speed);
+    slot.generation++;
+    slot.livePosition = static_cast<std::uint32_t>(live.size());
+    live.push_back(index);
+    return true;
+}
+
+auto WordPool::despawn(const WordHandle& handle) -> bool {
+    if (!isLive(handle)) {
+        return false;
+    }
+
+    auto& slot = slots[handle.index];
+    auto lastIndex = live.back();
+    live[slot.livePosition] = lastIndex;
+    slots[lastIndex].livePosition = slot.livePosition;
+    live.pop_back();
+
+    //Invalidates outstanding handles right away, the next spawn bumps it again
+    slot.generation++;
+    freeList.push_back(handle.index);
+    return true;
+}
+
+auto WordPool::clear() -> void {
+    while (!live.empty()) {
+        despawn(handleAt(live.size() - 1));
+    }
+}
+
+auto WordPool::get(const WordHandle& handle) -> Word* {
+    if (!isLive(handle)) {
+        return nullptr;
+    }
+    return &slots[handle.index].word;
+}
+
+auto WordPool::isLive(const WordHandle& handle) const -> bool {
+    if (handle.index >= slots.size() || slots[handle.index].generation != handle.generation) {
+        return false;
+    }
+    auto position = slots[handle.index].livePosition;
+    return position < live.size() && live[position] == handle.index;
+}
+
+auto WordPool::size() const -> std::size_t {
+    return live.size();
+}
+
+auto WordPool::capacity() const -> std::size_t {
+    return slots.size();
+}
+
+auto WordPool::empty() const -> bool {
+    return live.empty();
+}
+
+auto WordPool::at(const std::size_t& position) -> Word& {
+    return slots[live[position]].word;
+}
+
+auto WordPool::handleAt(const std::size_t& position) const -> WordHandle {
+    auto index = live[position];
+    return {index, slots[index].generation};
+}
+
+auto WordPool::begin() const -> Iterator {
+    return {this, 0};
+}
+
+auto WordPool::end() const -> Iterator {
+    return {this, live.size()};
+}
\ No newline at end of file
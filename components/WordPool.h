@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "Word.h"
+
+struct WordHandle {
+    std::uint32_t index = 0;
+    std::uint32_t generation = 0;
+};
+
+// Fixed number of word slots allocated up front. Despawned slots go on a free list and
+// are reused by the next spawn; a handle stays valid until its slot is recycled, which
+// bumps the slot's generation. Live words are kept in a dense index list so removing
+// one is a swap with the last entry instead of shifting every following word.
+class WordPool {
+public:
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Word;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Word*;
+        using reference = const Word&;
+
+        Iterator(const WordPool* pool, std::size_t position) : pool(pool), position(position) {}
+        auto operator*() const -> const Word& { return pool->slots[pool->live[position]].word; }
+        auto operator->() const -> const Word* { return &**this; }
+        auto operator++() -> Iterator& { position++; return *this; }
+        auto operator++(int) -> Iterator { auto copy = *this; position++; return copy; }
+        auto operator==(const Iterator& other) const -> bool { return position == other.position; }
+        auto handle() const -> WordHandle { return pool->handleAt(position); }
+
+    private:
+        const WordPool* pool;
+        std::size_t position;
+    };
+
+    WordPool(const std::size_t& capacity, const std::size_t& textCapacity);
+
+    auto spawn(const std::string& text, float x, float y, float speed) -> bool;
+    auto despawn(const WordHandle& handle) -> bool;
+    auto clear() -> void;
+    auto get(const WordHandle& handle) -> Word*;
+
+    auto size() const -> std::size_t;
+    auto capacity() const -> std::size_t;
+    auto empty() const -> bool;
+    auto at(const std::size_t& position) -> Word&;
+    auto handleAt(const std::size_t& position) const -> WordHandle;
+    auto begin() const -> Iterator;
+    auto end() const -> Iterator;
+
+private:
+    struct Slot {
+        Word word;
+        //Starts above any default handle's generation, so WordHandle{} never names a slot
+        std::uint32_t generation = 1;
+        std::uint32_t livePosition = 0;
+    };
+
+    auto isLive(const WordHandle& handle) const -> bool;
+
+    std::vector<Slot> slots;
+    std::vector<std::uint32_t> freeList;
+    std::vector<std::uint32_t> live;
+};
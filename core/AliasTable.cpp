@@ -0,0 +1,59 @@
+#include "AliasTable.h"
+#include <numeric>
+
+auto AliasTable::build(const std::vector<double>& weights) -> void {
+    auto count = weights.size();
+    probability.assign(count, 1.0f);
+    alias.resize(count);
+    for (auto i = std::size_t(0); i < count; i++) {
+        alias[i] = static_cast<std::uint32_t>(i);
+    }
+
+    auto total = std::accumulate(weights.begin(), weights.end(), 0.0);
+    if (count == 0 || total <= 0.0) {
+        return;
+    }
+
+    //Scale so the average column is exactly full, then let every overfull column top up an underfull one
+    auto scaled = std::vector<double>(count);
+    auto small = std::vector<std::uint32_t>();
+    auto large = std::vector<std::uint32_t>();
+    for (auto i = std::size_t(0); i < count; i++) {
+        scaled[i] = weights[i] * count / total;
+        (scaled[i] < 1.0 ? small : large).push_back(static_cast<std::uint32_t>(i));
+    }
+
+    while (!small.empty() && !large.empty()) {
+        auto less = small.back();
+        small.pop_back();
+        auto more = large.back();
+        large.pop_back();
+
+        probability[less] = static_cast<float>(scaled[less]);
+        alias[less] = more;
+        scaled[more] = scaled[more] + scaled[less] - 1.0;
+        (scaled[more] < 1.0 ? small : large).push_back(more);
+    }
+
+    //Whatever is left over is full up to rounding error
+    for (auto index : small) {
+        probability[index] = 1.0f;
+    }
+    for (auto index : large) {
+        probability[index] = 1.0f;
+    }
+}
+
+auto AliasTable::sample(std::mt19937& generator) const -> std::size_t {
+    auto column = std::uniform_int_distribution<std::size_t>(0, probability.size() - 1)(generator);
+    auto coin = std::uniform_real_distribution<float>(0.0f, 1.0f)(generator);
+    return coin < probability[column] ? column : alias[column];
+}
+
+auto AliasTable::size() const -> std::size_t {
+    return probability.size();
+}
+
+auto AliasTable::empty() const -> bool {
+    return probability.empty();
+}
\ No newline at end of file
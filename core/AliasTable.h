@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Walker's alias method as described by Vose: after an O(n) build, drawing from an
+// arbitrary discrete distribution takes one uniform index and one uniform float.
+// https://www.keithschwarz.com/darts-dice-coins/
+class AliasTable {
+public:
+    auto build(const std::vector<double>& weights) -> void;
+    auto sample(std::mt19937& generator) const -> std::size_t;
+    auto size() const -> std::size_t;
+    auto empty() const -> bool;
+
+private:
+    std::vector<float> probability;
+    std::vector<std::uint32_t> alias;
+};
\ No newline at end of file
@@ -0,0 +1,160 @@
+#include "AllocationTracker.h"
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <fmt/format.h>
+
+namespace {
+    thread_local AllocationPhase currentPhase = AllocationPhase::Other;
+    thread_local AllocationTracker::Counters counters;
+}
+
+auto AllocationTracker::isEnabled() -> bool {
+#ifdef MONKEYTYPER_TRACK_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+auto AllocationTracker::setPhase(const AllocationPhase& phase) -> AllocationPhase {
+    auto previous = currentPhase;
+    currentPhase = phase;
+    return previous;
+}
+
+auto AllocationTracker::read() -> Counters {
+    return counters;
+}
+
+auto AllocationTracker::getPhaseName(const AllocationPhase& phase) -> const char* {
+    switch (phase) {
+        case AllocationPhase::Other: return "other";
+        case AllocationPhase::Events: return "events";
+        case AllocationPhase::Input: return "input";
+        case AllocationPhase::Update: return "update";
+        case AllocationPhase::Snapshot: return "snapshot";
+        case AllocationPhase::Render: return "render";
+        case AllocationPhase::Present: return "present";
+        default: return "other";
+    }
+}
+
+AllocationMonitor::AllocationMonitor(const std::string& name, const std::vector<AllocationPhase>& guardedPhases, const int& reportInterval)
+    : name(name), guardedPhases(guardedPhases), reportInterval(reportInterval), last(AllocationTracker::read()) {}
+
+auto AllocationMonitor::endFrame(const bool& steady) -> bool {
+    auto current = AllocationTracker::read();
+    auto clean = true;
+    for (auto phase = std::size_t(0); phase < AllocationTracker::phaseCount; phase++) {
+        auto allocations = current.allocations[phase] - last.allocations[phase];
+        auto bytes = current.bytes[phase] - last.bytes[phase];
+        total.allocations[phase] += allocations;
+        total.bytes[phase] += bytes;
+
+        auto guarded = std::find(guardedPhases.begin(), guardedPhases.end(), static_cast<AllocationPhase>(phase)) != guardedPhases.end();
+        if (steady && guarded && allocations > 0) {
+            fmt::print(stderr, "[alloc] {}: steady frame allocated {} times ({} bytes) in {}\n",
+                       name, allocations, bytes, AllocationTracker::getPhaseName(static_cast<AllocationPhase>(phase)));
+            clean = false;
+        }
+    }
+
+    frames++;
+    if (steady) {
+        steadyFrames++;
+    }
+    if (frames == reportInterval) {
+        report();
+    }
+
+    //Whatever the report itself allocated is not charged to the next frame
+    last = AllocationTracker::read();
+    return clean;
+}
+
+auto AllocationMonitor::getSteadyFrames() const -> int {
+    return steadyFrames;
+}
+
+auto AllocationMonitor::report() -> void {
+    auto line = fmt::memory_buffer();
+    fmt::format_to(std::back_inserter(line), "[alloc] {} per frame:", name);
+    for (auto phase = std::size_t(0); phase < AllocationTracker::phaseCount; phase++) {
+        if (total.allocations[phase] > 0) {
+            fmt::format_to(std::back_inserter(line), " {} {:.1f} ({:.0f} B)",
+                           AllocationTracker::getPhaseName(static_cast<AllocationPhase>(phase)),
+                           static_cast<double>(total.allocations[phase]) / frames,
+                           static_cast<double>(total.bytes[phase]) / frames);
+        }
+    }
+    fmt::print(stderr, "{}\n", fmt::to_string(line));
+
+    frames = 0;
+    total = AllocationTracker::Counters();
+}
+
+#ifdef MONKEYTYPER_TRACK_ALLOCATIONS
+//Every replaceable allocation function funnels into these two, the deallocation functions only need to match the allocator
+//https://en.cppreference.com/w/cpp/memory/new/operator_new
+namespace {
+    auto count(const std::size_t& size) -> void {
+        auto phase = static_cast<std::size_t>(currentPhase);
+        counters.allocations[phase]++;
+        counters.bytes[phase] += size;
+    }
+
+    auto allocate(std::size_t size) -> void* {
+        count(size);
+        auto pointer = std::malloc(size == 0 ? 1 : size);
+        if (!pointer) {
+            throw std::bad_alloc();
+        }
+        return pointer;
+    }
+
+    auto allocateAligned(std::size_t size, std::align_val_t alignment) -> void* {
+        count(size);
+        auto align = static_cast<std::size_t>(alignment);
+#ifdef _WIN32
+        auto pointer = _aligned_malloc(size == 0 ? 1 : size, align);
+#else
+        auto pointer = std::aligned_alloc(align, (size + align - 1) / align * align);
+#endif
+        if (!pointer) {
+            throw std::bad_alloc();
+        }
+        return pointer;
+    }
+
+    auto freeAligned(void* pointer) -> void {
+#ifdef _WIN32
+        _aligned_free(pointer);
+#else
+        std::free(pointer);
+#endif
+    }
+}
+
+auto operator new(std::size_t size) -> void* { return allocate(size); }
+auto operator new[](std::size_t size) -> void* { return allocate(size); }
+auto operator new(std::size_t size, const std::nothrow_t&) noexcept -> void* { try { return allocate(size); } catch (...) { return nullptr; } }
+auto operator new[](std::size_t size, const std::nothrow_t&) noexcept -> void* { try { return allocate(size); } catch (...) { return nullptr; } }
+auto operator new(std::size_t size, std::align_val_t alignment) -> void* { return allocateAligned(size, alignment); }
+auto operator new[](std::size_t size, std::align_val_t alignment) -> void* { return allocateAligned(size, alignment); }
+auto operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept -> void* { try { return allocateAligned(size, alignment); } catch (...) { return nullptr; } }
+auto operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept -> void* { try { return allocateAligned(size, alignment); } catch (...) { return nullptr; } }
+
+auto operator delete(void* pointer) noexcept -> void { std::free(pointer); }
+auto operator delete[](void* pointer) noexcept -> void { std::free(pointer); }
+auto operator delete(void* pointer, std::size_t) noexcept -> void { std::free(pointer); }
+auto operator delete[](void* pointer, std::size_t) noexcept -> void { std::free(pointer); }
+auto operator delete(void* pointer, const std::nothrow_t&) noexcept -> void { std::free(pointer); }
+auto operator delete[](void* pointer, const std::nothrow_t&) noexcept -> void { std::free(pointer); }
+auto operator delete(void* pointer, std::align_val_t) noexcept -> void { freeAligned(pointer); }
+auto operator delete[](void* pointer, std::align_val_t) noexcept -> void { freeAligned(pointer); }
+auto operator delete(void* pointer, std::size_t, std::align_val_t) noexcept -> void { freeAligned(pointer); }
+auto operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept -> void { freeAligned(pointer); }
+auto operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept -> void { freeAligned(pointer); }
+auto operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept -> void { freeAligned(pointer); }
+#endif
\ No newline at end of file
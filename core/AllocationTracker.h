@@ -0,0 +1,58 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../enums/AllocationPhase.h"
+
+// Counts heap allocations made by the calling thread, split by the phase of the frame it
+// was in. Counting only happens in builds configured with MONKEYTYPER_TRACK_ALLOCATIONS,
+// which replace the global operator new; in every other build the counters stay at zero.
+namespace AllocationTracker {
+    constexpr std::size_t phaseCount = 7;
+
+    struct Counters {
+        std::array<std::uint64_t, phaseCount> allocations = {};
+        std::array<std::uint64_t, phaseCount> bytes = {};
+    };
+
+    auto isEnabled() -> bool;
+    auto setPhase(const AllocationPhase& phase) -> AllocationPhase;
+    auto read() -> Counters;
+    auto getPhaseName(const AllocationPhase& phase) -> const char*;
+}
+
+// Marks everything allocated until the end of the scope as belonging to one phase.
+class AllocationScope {
+public:
+    explicit AllocationScope(const AllocationPhase& phase) : previous(AllocationTracker::setPhase(phase)) {}
+    ~AllocationScope() { AllocationTracker::setPhase(previous); }
+    AllocationScope(const AllocationScope&) = delete;
+    auto operator=(const AllocationScope&) -> AllocationScope& = delete;
+
+private:
+    AllocationPhase previous;
+};
+
+// Turns one thread's running counters into per-frame figures. Prints the average of every
+// phase once per reportInterval frames and remembers whether a frame marked as steady
+// allocated in one of the guarded phases.
+class AllocationMonitor {
+public:
+    AllocationMonitor(const std::string& name, const std::vector<AllocationPhase>& guardedPhases, const int& reportInterval = 300);
+
+    auto endFrame(const bool& steady) -> bool;
+    auto getSteadyFrames() const -> int;
+
+private:
+    auto report() -> void;
+
+    std::string name;
+    std::vector<AllocationPhase> guardedPhases;
+    int reportInterval;
+    int frames = 0;
+    int steadyFrames = 0;
+    AllocationTracker::Counters last;
+    AllocationTracker::Counters total;
+};
\ No newline at end of file
@@ -0,0 +1,114 @@
+#include "Assets.h"
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <sstream>
+
+#ifdef MONKEYTYPER_EMBED_ASSETS
+#include "EmbeddedAssets.h"
+#endif
+
+namespace {
+    auto findOnDisk(const std::string& path) -> std::optional<std::filesystem::path> {
+        if (auto overrideDirectory = std::getenv("MONKEYTYPER_ASSET_DIR")) {
+            auto candidate = std::filesystem::path(overrideDirectory) / path;
+            if (std::filesystem::exists(candidate)) {
+                return candidate;
+            }
+        }
+
+#ifdef MONKEYTYPER_EMBED_ASSETS
+        return std::nullopt;
+#else
+        return std::filesystem::path("assets") / path;
+#endif
+    }
+
+    struct Memory {
+        const void* data;
+        std::size_t size;
+    };
+
+    auto findEmbedded(const std::string& path) -> std::optional<Memory> {
+#ifdef MONKEYTYPER_EMBED_ASSETS
+        for (auto i = 0; i < embeddedAssetCount; i++) {
+            if (path == embeddedAssets[i].path) {
+                return Memory{embeddedAssets[i].data, embeddedAssets[i].size};
+            }
+        }
+#endif
+        return std::nullopt;
+    }
+}
+
+auto Assets::loadFont(sf::Font& font, const std::string& path) -> bool {
+    //Fonts are streamed lazily, the embedded data stays alive for the whole run
+    if (auto file = findOnDisk(path)) {
+        if (font.openFromFile(*file)) {
+            return true;
+        }
+    }
+
+    if (auto memory = findEmbedded(path)) {
+        return font.openFromMemory(memory->data, memory->size);
+    }
+    return false;
+}
+
+auto Assets::loadTexture(sf::Texture& texture, const std::string& path) -> bool {
+    if (auto file = findOnDisk(path)) {
+        if (texture.loadFromFile(*file)) {
+            return true;
+        }
+    }
+
+    if (auto memory = findEmbedded(path)) {
+        return texture.loadFromMemory(memory->data, memory->size);
+    }
+    return false;
+}
+
+auto Assets::loadImage(sf::Image& image, const std::string& path) -> bool {
+    if (auto file = findOnDisk(path)) {
+        if (image.loadFromFile(*file)) {
+            return true;
+        }
+    }
+
+    if (auto memory = findEmbedded(path)) {
+        return image.loadFromMemory(memory->data, memory->size);
+    }
+    return false;
+}
+
+auto Assets::loadSoundBuffer(sf::SoundBuffer& soundBuffer, const std::string& path) -> bool {
+    if (auto file = findOnDisk(path)) {
+        if (soundBuffer.loadFromFile(*file)) {
+            return true;
+        }
+    }
+
+    if (auto memory = findEmbedded(path)) {
+        return soundBuffer.loadFromMemory(memory->data, memory->size);
+    }
+    return false;
+}
+
+auto Assets::readText(const std::string& path, std::string& text) -> bool {
+    if (auto file = findOnDisk(path)) {
+        auto stream = std::ifstream(*file, std::ios::binary);
+        if (stream.is_open()) {
+            auto buffer = std::stringstream();
+            buffer << stream.rdbuf();
+            text = buffer.str();
+            return true;
+        }
+    }
+
+    if (auto memory = findEmbedded(path)) {
+        text.assign(static_cast<const char*>(memory->data), memory->size);
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <SFML/Audio.hpp>
+#include <string>
+
+// Read-only game assets addressed by their path below assets/, e.g. "fonts/arial.ttf".
+// With MONKEYTYPER_EMBED_ASSETS they come from data compiled into the executable,
+// otherwise from the assets/ directory next to the working directory. Setting
+// MONKEYTYPER_ASSET_DIR makes files found there win over both, for development.
+namespace Assets {
+    auto loadFont(sf::Font& font, const std::string& path) -> bool;
+    auto loadTexture(sf::Texture& texture, const std::string& path) -> bool;
+    auto loadImage(sf::Image& image, const std::string& path) -> bool;
+    auto loadSoundBuffer(sf::SoundBuffer& soundBuffer, const std::string& path) -> bool;
+    auto readText(const std::string& path, std::string& text) -> bool;
+}
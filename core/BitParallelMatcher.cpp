@@ -0,0 +1,52 @@
+#include "BitParallelMatcher.h"
+
+auto BitParallelMatcher::setPattern(std::string_view pattern) -> bool {
+    for (auto i = 0; i < patternLength; i++) {
+        peq[static_cast<unsigned char>(this->pattern[i])] = 0;
+    }
+    patternLength = 0;
+
+    if (pattern.size() > maxPatternLength) {
+        return false;
+    }
+
+    for (auto i = 0; i < pattern.size(); i++) {
+        this->pattern[i] = pattern[i];
+        peq[static_cast<unsigned char>(pattern[i])] |= std::uint64_t(1) << i;
+    }
+    patternLength = pattern.size();
+    return true;
+}
+
+auto BitParallelMatcher::distance(std::string_view text) const -> int {
+    const auto m = static_cast<int>(patternLength);
+    if (m == 0) {
+        return static_cast<int>(text.size());
+    }
+
+    //Vertical deltas start at +1 (column 0 is 0..m), horizontal ones in row 0 are always +1
+    const auto last = std::uint64_t(1) << (m - 1);
+    auto pv = ~std::uint64_t(0);
+    auto mv = std::uint64_t(0);
+    auto score = m;
+
+    for (auto c : text) {
+        auto eq = peq[static_cast<unsigned char>(c)];
+        auto xv = eq | mv;
+        auto xh = (((eq & pv) + pv) ^ pv) | eq;
+        auto ph = mv | ~(xh | pv);
+        auto mh = pv & xh;
+
+        if (ph & last) {
+            score++;
+        } else if (mh & last) {
+            score--;
+        }
+
+        ph = (ph << 1) | 1;
+        mh = mh << 1;
+        pv = mh | ~(xv | ph);
+        mv = ph & xv;
+    }
+    return score;
+}
\ No newline at end of file
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+// Levenshtein distance between one pattern and many texts using Myers' bit-vector
+// algorithm in Hyyrö's formulation for global distance. The pattern's match masks are
+// built once, after that each text costs a handful of word operations per character
+// instead of a full dynamic programming table. Patterns are limited to 64 characters.
+class BitParallelMatcher {
+public:
+    static constexpr std::size_t maxPatternLength = 64;
+
+    auto setPattern(std::string_view pattern) -> bool;
+    auto distance(std::string_view text) const -> int;
+
+private:
+    std::array<std::uint64_t, 256> peq = {};
+    std::array<char, maxPatternLength> pattern = {};
+    std::size_t patternLength = 0;
+};
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstddef>
+
+// Generated by cmake/EmbedAssets.cmake when MONKEYTYPER_EMBED_ASSETS is on.
+struct EmbeddedAsset {
+    const char* path;
+    const unsigned char* data;
+    std::size_t size;
+};
+
+extern const EmbeddedAsset embeddedAssets[];
+extern const std::size_t embeddedAssetCount;
@@ -0,0 +1,146 @@
+#include "EventLog.h"
+#include <algorithm>
+
+namespace {
+    std::atomic<std::uint64_t> nextLogId = 1;
+
+    struct CachedRing {
+        std::uint64_t logId = 0;
+        void* ring = nullptr;
+    };
+
+    thread_local CachedRing cachedRing;
+}
+
+EventLog::EventLog(const bool& waitWhenFull) : id(nextLogId.fetch_add(1)), waitWhenFull(waitWhenFull) {}
+
+EventLog::~EventLog() {
+    close();
+}
+
+auto EventLog::open(const std::string& path) -> bool {
+    close();
+
+    file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        return false;
+    }
+
+    auto header = EventLogFormat::Header{EventLogFormat::magic, EventLogFormat::version, sizeof(GameEventRecord)};
+    std::fwrite(&header, sizeof(header), 1, file);
+
+    openedAt = std::chrono::steady_clock::now();
+    batch.reserve(ringCapacity);
+    opened.store(true, std::memory_order_release);
+    flusher = std::jthread([this](std::stop_token stopToken) { flushLoop(stopToken); });
+    return true;
+}
+
+auto EventLog::close() -> void {
+    //Whoever logs must have stopped by now, the final drain picks up what is left in the rings
+    opened.store(false, std::memory_order_release);
+    if (flusher.joinable()) {
+        flusher.request_stop();
+        flusher.join();
+    }
+    if (file) {
+        drain();
+        std::fclose(file);
+        file = nullptr;
+    }
+}
+
+auto EventLog::isOpen() const -> bool {
+    return opened.load(std::memory_order_acquire);
+}
+
+auto EventLog::attachThread() -> void {
+    if (isOpen()) {
+        ringForThisThread();
+    }
+}
+
+auto EventLog::log(const GameEventType& type,
+                   const std::uint32_t& session,
+                   const std::uint64_t& tick,
+                   const std::string_view& word,
+                   const float& value0,
+                   const float& value1) -> void {
+    if (!isOpen()) {
+        return;
+    }
+
+    auto& ring = ringForThisThread();
+    auto head = ring.head.load(std::memory_order_relaxed);
+    while (head - ring.tail.load(std::memory_order_acquire) == ringCapacity) {
+        if (!waitWhenFull) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        std::this_thread::yield();
+    }
+
+    auto& record = ring.records[head % ringCapacity];
+    record.timeUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - openedAt).count();
+    record.tick = static_cast<std::uint32_t>(tick);
+    record.session = session;
+    record.type = type;
+    record.wordLength = static_cast<std::uint8_t>(std::min(word.size(), record.word.size()));
+    record.reserved = 0;
+    record.value0 = value0;
+    record.value1 = value1;
+    record.word.fill('\0');
+    std::copy_n(word.begin(), record.wordLength, record.word.begin());
+
+    ring.head.store(head + 1, std::memory_order_release);
+}
+
+auto EventLog::getDropped() const -> std::uint64_t {
+    return dropped.load(std::memory_order_relaxed);
+}
+
+auto EventLog::ringForThisThread() -> Ring& {
+    if (cachedRing.logId == id) {
+        return *static_cast<Ring*>(cachedRing.ring);
+    }
+
+    //First event from this thread, or it logged somewhere else in between
+    auto lock = std::lock_guard(ringsMutex);
+    auto owner = std::this_thread::get_id();
+    auto found = std::find_if(rings.begin(), rings.end(), [&owner](const auto& ring) {return ring->owner == owner;});
+    if (found == rings.end()) {
+        rings.push_back(std::make_unique<Ring>());
+        rings.back()->owner = owner;
+        found = rings.end() - 1;
+    }
+
+    cachedRing = {id, found->get()};
+    return **found;
+}
+
+auto EventLog::flushLoop(std::stop_token stopToken) -> void {
+    while (!stopToken.stop_requested()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        drain();
+    }
+}
+
+auto EventLog::drain() -> void {
+    batch.clear();
+    {
+        auto lock = std::lock_guard(ringsMutex);
+        for (auto& ring : rings) {
+            auto tail = ring->tail.load(std::memory_order_relaxed);
+            auto head = ring->head.load(std::memory_order_acquire);
+            for (; tail != head; tail++) {
+                batch.push_back(ring->records[tail % ringCapacity]);
+            }
+            ring->tail.store(tail, std::memory_order_release);
+        }
+    }
+
+    if (!batch.empty()) {
+        std::fwrite(batch.data(), sizeof(GameEventRecord), batch.size(), file);
+        std::fflush(file);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "../enums/GameEventType.h"
+
+// One fixed size record per event, written to disk as is (little endian on every platform we ship).
+//   Spawn:       word, value0 = y, value1 = speed in pixels per tick
+//   Hit:         word, value0 = seconds on screen, value1 = typo distance
+//   Miss:        word = what was typed
+//   Damage:      word = the word that escaped (empty for a miss), value0 = health left
+//   StateChange: value0 = previous GameState, value1 = new GameState
+struct GameEventRecord {
+    std::int64_t timeUs;
+    std::uint32_t tick;
+    std::uint32_t session;
+    GameEventType type;
+    std::uint8_t wordLength;
+    std::uint16_t reserved;
+    float value0;
+    float value1;
+    std::array<char, 20> word;
+};
+
+static_assert(sizeof(GameEventRecord) == 48);
+
+namespace EventLogFormat {
+    constexpr std::array<char, 8> magic = {'M', 'T', 'E', 'V', 'L', 'O', 'G', '1'};
+    constexpr std::uint32_t version = 1;
+
+    struct Header {
+        std::array<char, 8> magic;
+        std::uint32_t version;
+        std::uint32_t recordSize;
+    };
+}
+
+// Every thread that logs gets its own single producer ring, so logging is a copy and an atomic store.
+// A background thread drains the rings and appends them to the file in batches. A ring is allocated
+// on the thread's first event, attachThread() does that up front for threads that must not allocate later.
+class EventLog {
+public:
+    static constexpr std::size_t ringCapacity = 4096;
+
+    explicit EventLog(const bool& waitWhenFull = false);
+    ~EventLog();
+
+    auto open(const std::string& path) -> bool;
+    auto close() -> void;
+    auto isOpen() const -> bool;
+    auto attachThread() -> void;
+    auto log(const GameEventType& type,
+             const std::uint32_t& session,
+             const std::uint64_t& tick,
+             const std::string_view& word = {},
+             const float& value0 = 0.0f,
+             const float& value1 = 0.0f) -> void;
+    auto getDropped() const -> std::uint64_t;
+
+private:
+    struct Ring {
+        std::thread::id owner;
+        std::array<GameEventRecord, ringCapacity> records;
+        alignas(64) std::atomic<std::size_t> head = 0;
+        alignas(64) std::atomic<std::size_t> tail = 0;
+    };
+
+    auto ringForThisThread() -> Ring&;
+    auto flushLoop(std::stop_token stopToken) -> void;
+    auto drain() -> void;
+
+    std::uint64_t id;
+    bool waitWhenFull;
+    std::chrono::steady_clock::time_point openedAt;
+    std::FILE* file = nullptr;
+    std::atomic<bool> opened = false;
+    std::mutex ringsMutex;
+    std::vector<std::unique_ptr<Ring>> rings;
+    std::vector<GameEventRecord> batch;
+    std::atomic<std::uint64_t> dropped = 0;
+    std::jthread flusher;
+};
\ No newline at end of file
@@ -0,0 +1,108 @@
+#include "FramePacer.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+
+FramePacer::FramePacer(const FramePacing& mode, const unsigned int& targetFps)
+    : mode(mode),
+      targetFps(std::max(1u, targetFps)),
+      framePeriod(std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / this->targetFps))),
+      nextFrame(Clock::now()),
+      lastFrame(Clock::now()) {}
+
+auto FramePacer::apply(sf::RenderWindow& window) -> void {
+    //SFML's own limit sleeps with millisecond granularity, so it is never used here
+    window.setFramerateLimit(0);
+    window.setVerticalSyncEnabled(mode == FramePacing::VSync);
+    nextFrame = Clock::now();
+    frameCount = 0;
+}
+
+auto FramePacer::setMode(const FramePacing& mode) -> void {
+    this->mode = mode;
+}
+
+auto FramePacer::getMode() const -> FramePacing {
+    return mode;
+}
+
+auto FramePacer::getTargetFps() const -> unsigned int {
+    return targetFps;
+}
+
+auto FramePacer::waitForNextFrame() -> void {
+    if (mode == FramePacing::Capped) {
+        nextFrame += framePeriod;
+        auto currentTime = Clock::now();
+        if (currentTime - nextFrame > framePeriod) {
+            nextFrame = currentTime;
+        }
+        preciseSleepUntil(nextFrame);
+    }
+
+    auto currentTime = Clock::now();
+    lastFrameTime = std::chrono::duration<float, std::milli>(currentTime - lastFrame).count();
+    frameTimes[frameCount % historySize] = lastFrameTime;
+    frameCount++;
+    lastFrame = currentTime;
+}
+
+auto FramePacer::getStats() const -> FrameStats {
+    auto count = std::min(frameCount, historySize);
+    if (count == 0) {
+        return {};
+    }
+
+    auto stats = FrameStats();
+    stats.minMs = frameTimes[0];
+    stats.maxMs = frameTimes[0];
+    auto sum = 0.0;
+    for (auto i = 0; i < count; i++) {
+        sum += frameTimes[i];
+        stats.minMs = std::min<double>(stats.minMs, frameTimes[i]);
+        stats.maxMs = std::max<double>(stats.maxMs, frameTimes[i]);
+    }
+    stats.meanMs = sum / count;
+
+    auto squares = 0.0;
+    for (auto i = 0; i < count; i++) {
+        squares += (frameTimes[i] - stats.meanMs) * (frameTimes[i] - stats.meanMs);
+    }
+    stats.stdDevMs = std::sqrt(squares / count);
+    return stats;
+}
+
+auto FramePacer::getLastFrameTime() const -> float {
+    return lastFrameTime;
+}
+
+auto FramePacer::preciseSleepUntil(const Clock::time_point& deadline) -> void {
+    //Sleep in 1 ms steps while there is clearly time left, tracking how long such a sleep
+    //really takes, then spin for the remainder
+    static thread_local auto estimate = 2.0e-3;
+    static thread_local auto mean = 2.0e-3;
+    static thread_local auto m2 = 0.0;
+    static thread_local auto count = std::int64_t(1);
+
+    while (true) {
+        auto remaining = std::chrono::duration<double>(deadline - Clock::now()).count();
+        if (remaining <= estimate) {
+            break;
+        }
+
+        auto start = Clock::now();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        auto observed = std::chrono::duration<double>(Clock::now() - start).count();
+
+        count++;
+        auto delta = observed - mean;
+        mean += delta / count;
+        m2 += delta * (observed - mean);
+        estimate = mean + std::sqrt(m2 / (count - 1));
+    }
+
+    while (Clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <chrono>
+#include "../enums/FramePacing.h"
+
+struct FrameStats {
+    double meanMs = 0;
+    double stdDevMs = 0;
+    double minMs = 0;
+    double maxMs = 0;
+};
+
+// Paces the render loop. VSync and Uncapped leave the waiting to the driver (or to
+// nobody); Capped sleeps until shortly before the deadline and spins the rest, which
+// avoids the millisecond-scale overshoot of a plain sleep. Every mode records the
+// frame-to-frame time so the modes can be compared.
+class FramePacer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    FramePacer(const FramePacing& mode, const unsigned int& targetFps);
+
+    auto apply(sf::RenderWindow& window) -> void;
+    auto setMode(const FramePacing& mode) -> void;
+    auto getMode() const -> FramePacing;
+    auto getTargetFps() const -> unsigned int;
+    auto waitForNextFrame() -> void;
+    auto getStats() const -> FrameStats;
+    auto getLastFrameTime() const -> float;
+
+    static auto preciseSleepUntil(const Clock::time_point& deadline) -> void;
+
+private:
+    static constexpr std::size_t historySize = 240;
+
+    FramePacing mode;
+    unsigned int targetFps;
+    Clock::duration framePeriod;
+    Clock::time_point nextFrame;
+    Clock::time_point lastFrame;
+    std::array<float, historySize> frameTimes = {};
+    std::size_t frameCount = 0;
+    float lastFrameTime = 0.0f;
+};
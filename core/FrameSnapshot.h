@@ -0,0 +1,44 @@
+#pragma once
+
+#include <SFML/System.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../enums/GameState.h"
+#include "../enums/Difficulty.h"
+#include "../enums/WordPackage.h"
+#include "../enums/FramePacing.h"
+#include "../components/WordPool.h"
+
+struct WordView {
+    WordHandle handle;
+    std::string text;
+    sf::Vector2f position;
+};
+
+// One game session's share of a frame, split-screen mode has one per lane.
+struct LaneSnapshot {
+    std::vector<WordView> words;
+    std::string currentInput;
+    int score = 0;
+    int health = 0;
+    bool over = false;
+    bool levelComplete = false;
+};
+
+// Everything the render thread needs to draw one frame. Written by the simulation
+// thread and handed over through a TripleBuffer, never modified after publishing.
+struct FrameSnapshot {
+    std::uint64_t tick = 0;
+    GameState state = GameState::Menu;
+    int selectedButtonIndex = 0;
+    std::vector<LaneSnapshot> lanes;
+    int activeLane = 0;
+    Difficulty difficulty = Difficulty::Easy;
+    WordPackage wordPackage = WordPackage::English;
+    std::string font;
+    std::u32string wordCharacters;
+    FramePacing framePacing = FramePacing::Capped;
+    int typoTolerance = 0;
+    std::vector<std::vector<std::string>> leaderboard;
+};
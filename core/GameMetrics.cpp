@@ -0,0 +1,50 @@
+#include "GameMetrics.h"
+#include <cmath>
+
+auto AtomicHistogram::record(const double& valueMs) -> void {
+    auto index = std::size_t(0);
+    while (index < bounds.size() && valueMs > bounds[index]) {
+        index++;
+    }
+
+    buckets[index].fetch_add(1, std::memory_order_relaxed);
+    total.fetch_add(1, std::memory_order_relaxed);
+    sumMicroseconds.fetch_add(static_cast<std::uint64_t>(std::llround(valueMs * 1000.0)), std::memory_order_relaxed);
+}
+
+auto AtomicHistogram::bucketCount(const std::size_t& index) const -> std::uint64_t {
+    return buckets[index].load(std::memory_order_relaxed);
+}
+
+auto AtomicHistogram::count() const -> std::uint64_t {
+    return total.load(std::memory_order_relaxed);
+}
+
+auto AtomicHistogram::sumMs() const -> double {
+    return sumMicroseconds.load(std::memory_order_relaxed) / 1000.0;
+}
+
+auto AtomicHistogram::percentile(const double& fraction) const -> double {
+    auto counts = std::array<std::uint64_t, bounds.size() + 1>();
+    auto all = std::uint64_t(0);
+    for (auto i = 0; i < counts.size(); i++) {
+        counts[i] = bucketCount(i);
+        all += counts[i];
+    }
+    if (all == 0) {
+        return 0.0;
+    }
+
+    //Interpolate linearly inside the bucket the rank falls into
+    auto rank = fraction * all;
+    auto seen = 0.0;
+    for (auto i = 0; i < counts.size(); i++) {
+        if (seen + counts[i] >= rank && counts[i] > 0) {
+            auto lower = i == 0 ? 0.0 : bounds[i - 1];
+            auto upper = i < bounds.size() ? bounds[i] : bounds.back() * 2;
+            return lower + (upper - lower) * (rank - seen) / counts[i];
+        }
+        seen += counts[i];
+    }
+    return bounds.back();
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+// Cumulative histogram with fixed bucket bounds, safe to record into from one thread
+// while another one reads it. Values are in milliseconds.
+class AtomicHistogram {
+public:
+    static constexpr std::array<double, 16> bounds = {1, 2, 4, 6, 8, 10, 12, 14, 16, 17, 18, 20, 25, 33, 50, 100};
+
+    auto record(const double& valueMs) -> void;
+    auto bucketCount(const std::size_t& index) const -> std::uint64_t;
+    auto count() const -> std::uint64_t;
+    auto sumMs() const -> double;
+    auto percentile(const double& fraction) const -> double;
+
+private:
+    std::array<std::atomic<std::uint64_t>, bounds.size() + 1> buckets = {};
+    std::atomic<std::uint64_t> total = 0;
+    std::atomic<std::uint64_t> sumMicroseconds = 0;
+};
+
+// Counters bumped by the game loop and read by the metrics exporter. Every access is
+// a relaxed atomic, the game never waits on a reader.
+struct GameMetrics {
+    AtomicHistogram frameTime;
+    AtomicHistogram inputLatency;
+    std::atomic<std::uint64_t> frames = 0;
+    std::atomic<std::uint64_t> ticks = 0;
+    std::atomic<std::uint64_t> wordsSpawned = 0;
+    std::atomic<std::int64_t> liveWords = 0;
+    std::atomic<std::int64_t> score = 0;
+    std::atomic<std::int64_t> health = 0;
+    std::atomic<std::int64_t> gameState = 0;
+    std::atomic<double> spawnIntervalSeconds = 0;
+};
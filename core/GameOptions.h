@@ -0,0 +1,19 @@
+#pragma once
+
+#include <string>
+#include "../enums/FramePacing.h"
+
+// Settings taken from the command line, see parseGameOptions in main.cpp.
+struct GameOptions {
+    static constexpr int maxLanes = 4;
+    static constexpr unsigned int maxTargetFps = 1000;
+
+    FramePacing framePacing = FramePacing::Capped;
+    unsigned int targetFps = 60;
+    unsigned short metricsPort = 0;
+    std::string metricsSocket;
+    std::string eventLogPath;
+    bool allocationGuard = false;
+    int lanes = 1;
+    std::string levelPath;
+};
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <SFML/Window.hpp>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+struct QueuedEvent {
+    sf::Event event;
+    std::chrono::steady_clock::time_point polledAt;
+};
+
+// Hands window events from the thread that owns the window over to the simulation thread.
+class InputQueue {
+public:
+    auto push(const sf::Event& event) -> void {
+        auto polledAt = std::chrono::steady_clock::now();
+        auto lock = std::lock_guard(mutex);
+        pending.push_back({event, polledAt});
+    }
+
+    auto drain(std::vector<QueuedEvent>& out) -> void {
+        out.clear();
+        auto lock = std::lock_guard(mutex);
+        pending.swap(out);
+    }
+
+private:
+    std::mutex mutex;
+    std::vector<QueuedEvent> pending;
+};
@@ -0,0 +1,220 @@
+#include "LevelCompiler.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "LevelReader.h"
+
+namespace {
+    struct Command {
+        int line;
+        std::vector<std::string> words;
+        std::vector<std::size_t> columns;
+    };
+
+    auto fail(const Command& command, const std::string& message) -> std::runtime_error {
+        return std::runtime_error("line " + std::to_string(command.line) + ": " + message);
+    }
+
+    auto failAt(const Command& command, const std::size_t& column, const std::string& message) -> std::runtime_error {
+        return std::runtime_error("line " + std::to_string(command.line) + ", column " + std::to_string(column) + ": " + message);
+    }
+
+    auto parseNumber(const Command& command, const std::string& value) -> double {
+        try {
+            auto used = std::size_t(0);
+            auto number = std::stod(value, &used);
+            if (used == value.size() && std::isfinite(number)) {
+                return number;
+            }
+        } catch (const std::exception&) {
+        }
+        throw fail(command, "'" + value + "' is not a number");
+    }
+
+    auto parseRow(const Command& command, const std::string& value) -> int {
+        if (value == "random") {
+            return -1;
+        }
+        auto row = parseNumber(command, value);
+        if (row != std::floor(row) || row < 0 || row >= LevelFormat::rowCount) {
+            throw fail(command, "rows go from 0 to " + std::to_string(LevelFormat::rowCount - 1) + " or are random");
+        }
+        return static_cast<int>(row);
+    }
+
+    auto parseSpeed(const Command& command, const std::string& value, const double& current) -> double {
+        //A leading sign makes the speed relative, so repeats can ramp it up or down
+        auto speed = parseNumber(command, value);
+        if (value[0] == '+' || value[0] == '-') {
+            speed += current;
+        }
+        if (speed <= 0 || speed * LevelFormat::speedScale > 0xffff) {
+            throw fail(command, "speed has to be above 0 and at most " + std::to_string(0xffff / LevelFormat::speedScale));
+        }
+        return speed;
+    }
+
+    class Emitter {
+    public:
+        explicit Emitter(std::ostream& timeline) : timeline(timeline) {}
+
+        auto run(const std::vector<Command>& commands, const std::size_t& begin, const std::size_t& end) -> void {
+            for (auto i = begin; i < end; i++) {
+                const auto& command = commands[i];
+                if (command.words[0] == "repeat") {
+                    auto close = findEnd(commands, i, end);
+                    auto count = command.words.size() == 2 ? parseNumber(command, command.words[1]) : -1.0;
+                    if (count < 0 || count != std::floor(count)) {
+                        throw fail(command, "repeat takes a count of 0 or more");
+                    }
+                    for (auto n = 0.0; n < count; n++) {
+                        run(commands, i + 1, close);
+                    }
+                    i = close;
+                } else if (command.words[0] == "end") {
+                    throw fail(command, "end without a repeat");
+                } else {
+                    execute(command);
+                }
+            }
+        }
+
+        auto getSummary() const -> const LevelCompiler::Summary& {
+            return summary;
+        }
+
+    private:
+        static auto findEnd(const std::vector<Command>& commands, const std::size_t& repeat, const std::size_t& end) -> std::size_t {
+            auto depth = 0;
+            for (auto i = repeat + 1; i < end; i++) {
+                if (commands[i].words[0] == "repeat") {
+                    depth++;
+                } else if (commands[i].words[0] == "end" && depth-- == 0) {
+                    return i;
+                }
+            }
+            throw fail(commands[repeat], "repeat without an end");
+        }
+
+        auto execute(const Command& command) -> void {
+            const auto& name = command.words[0];
+            const auto& arguments = command.words;
+
+            if (name == "wait" && arguments.size() == 2) {
+                auto seconds = parseNumber(command, arguments[1]);
+                if (seconds < 0) {
+                    throw fail(command, "cannot wait a negative time");
+                }
+                cursor += seconds;
+            } else if (name == "speed" && arguments.size() == 2) {
+                speed = parseSpeed(command, arguments[1], speed);
+            } else if (name == "row" && arguments.size() == 2) {
+                row = parseRow(command, arguments[1]);
+            } else if (name == "spawn" && arguments.size() % 2 == 0) {
+                auto spawnRow = row;
+                auto spawnSpeed = speed;
+                for (auto i = std::size_t(2); i < arguments.size(); i += 2) {
+                    if (arguments[i] == "row") {
+                        spawnRow = parseRow(command, arguments[i + 1]);
+                    } else if (arguments[i] == "speed") {
+                        spawnSpeed = parseSpeed(command, arguments[i + 1], speed);
+                    } else {
+                        throw fail(command, "spawn only takes row and speed, not '" + arguments[i] + "'");
+                    }
+                }
+                spawn(command, command.columns[1], arguments[1], spawnRow, spawnSpeed);
+            } else {
+                throw fail(command, "unknown command or wrong number of arguments: " + name);
+            }
+        }
+
+        auto spawn(const Command& command,
+                   const std::size_t& column,
+                   const std::string& word,
+                   const int& spawnRow,
+                   const double& spawnSpeed) -> void {
+            //The game only takes a to z as input, any other character would make the word impossible to type
+            auto text = word == "*" ? std::string() : word;
+            auto invalid = std::find_if(text.begin(), text.end(), [](const char& c) {return c < 'a' || c > 'z';});
+            if (invalid != text.end()) {
+                throw failAt(command, column + (invalid - text.begin()), "words can only use the letters a to z");
+            }
+            if (text.size() > LevelFormat::maxWordLength) {
+                throw failAt(command, column, "words are at most " + std::to_string(LevelFormat::maxWordLength) + " characters");
+            }
+
+            auto tick = static_cast<std::uint64_t>(std::llround(cursor * LevelFormat::ticksPerSecond));
+            auto delta = tick - lastTick;
+            lastTick = tick;
+            do {
+                auto byte = static_cast<std::uint8_t>(delta & 0x7f);
+                delta >>= 7;
+                put(delta > 0 ? byte | 0x80 : byte);
+            } while (delta > 0);
+
+            auto encodedSpeed = static_cast<std::uint16_t>(std::lround(spawnSpeed * LevelFormat::speedScale));
+            put(spawnRow < 0 ? LevelFormat::randomRow : static_cast<std::uint8_t>(spawnRow));
+            put(encodedSpeed & 0xff);
+            put(encodedSpeed >> 8);
+            put(static_cast<std::uint8_t>(text.size()));
+            timeline.write(text.data(), static_cast<std::streamsize>(text.size()));
+            summary.bytes += text.size();
+
+            summary.events++;
+            summary.ticks = tick;
+        }
+
+        auto put(const int& byte) -> void {
+            timeline.put(static_cast<char>(byte));
+            summary.bytes++;
+        }
+
+        std::ostream& timeline;
+        LevelCompiler::Summary summary;
+        double cursor = 0.0;
+        std::uint64_t lastTick = 0;
+        double speed = 2.0;
+        int row = -1;
+    };
+}
+
+auto LevelCompiler::compile(std::istream& script, std::ostream& timeline) -> Summary {
+    auto commands = std::vector<Command>();
+    auto line = std::string();
+    for (auto number = 1; std::getline(script, line); number++) {
+        //Columns are kept next to the words, so errors can point at the character itself
+        auto text = line.substr(0, line.find('#'));
+        auto command = Command{number, {}, {}};
+        for (auto start = text.find_first_not_of(" \t\r"); start != std::string::npos;) {
+            auto end = std::min(text.find_first_of(" \t\r", start), text.size());
+            command.words.push_back(text.substr(start, end - start));
+            command.columns.push_back(start + 1);
+            start = text.find_first_not_of(" \t\r", end);
+        }
+        if (!command.words.empty()) {
+            commands.push_back(command);
+        }
+    }
+
+    //The event count is only known at the end, the header is written again once it is
+    auto header = LevelFormat::Header{LevelFormat::magic, LevelFormat::version, 0};
+    auto start = timeline.tellp();
+    timeline.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    auto emitter = Emitter(timeline);
+    emitter.run(commands, 0, commands.size());
+    auto summary = emitter.getSummary();
+    summary.bytes += sizeof(header);
+
+    header.eventCount = summary.events;
+    auto end = timeline.tellp();
+    timeline.seekp(start);
+    timeline.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    timeline.seekp(end);
+    if (!timeline) {
+        throw std::runtime_error("could not write the timeline");
+    }
+    return summary;
+}
\ No newline at end of file
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+
+// Compiles a level script into the timeline LevelReader plays. One command per line, # starts a comment:
+//   wait SECONDS                              moves the time cursor forward
+//   speed PIXELS_PER_TICK                     speed of the following spawns, +N or -N changes it by N
+//   row N|random                              row of the following spawns, 0 is the top row
+//   spawn WORD|* [row N|random] [speed S]     one word of a to z at the cursor, * picks one from the word package
+//   repeat COUNT ... end                      runs the commands in between COUNT times, can be nested
+// Repeats are unrolled, the timeline only ever holds spawns. Errors throw std::runtime_error naming the line, and the column where it helps.
+namespace LevelCompiler {
+    struct Summary {
+        std::uint32_t events = 0;
+        std::uint64_t ticks = 0;
+        std::uint64_t bytes = 0;
+    };
+
+    auto compile(std::istream& script, std::ostream& timeline) -> Summary;
+}
\ No newline at end of file
@@ -0,0 +1,105 @@
+#include "LevelReader.h"
+
+auto LevelReader::open(const std::string& path) -> bool {
+    file.open(path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    auto header = LevelFormat::Header();
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.magic != LevelFormat::magic
+        || header.version != LevelFormat::version) {
+        file.close();
+        return false;
+    }
+    eventCount = header.eventCount;
+
+    //FNV-1a over the whole file, read once here in buffer sized steps
+    hash = 0xcbf29ce484222325ull;
+    file.seekg(0);
+    auto buffer = std::array<char, 4096>();
+    while (file.read(buffer.data(), buffer.size()) || file.gcount() > 0) {
+        for (auto i = std::streamsize(0); i < file.gcount(); i++) {
+            hash = (hash ^ static_cast<std::uint8_t>(buffer[i])) * 0x100000001b3ull;
+        }
+    }
+
+    rewind();
+    return true;
+}
+
+auto LevelReader::isOpen() const -> bool {
+    return file.is_open();
+}
+
+auto LevelReader::getEventCount() const -> std::uint32_t {
+    return eventCount;
+}
+
+auto LevelReader::getHash() const -> std::uint64_t {
+    return hash;
+}
+
+auto LevelReader::rewind() -> void {
+    seek({sizeof(LevelFormat::Header), 0});
+}
+
+auto LevelReader::next(LevelEvent& event) -> bool {
+    auto delta = std::uint64_t(0);
+    auto byte = std::uint8_t(0);
+    for (auto shift = 0; shift < 64; shift += 7) {
+        if (!readByte(byte)) {
+            return false;
+        }
+        delta |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            break;
+        }
+    }
+
+    auto row = std::uint8_t(0);
+    auto speedLow = std::uint8_t(0);
+    auto speedHigh = std::uint8_t(0);
+    auto length = std::uint8_t(0);
+    if (!readByte(row) || !readByte(speedLow) || !readByte(speedHigh) || !readByte(length)
+        || length > LevelFormat::maxWordLength) {
+        return false;
+    }
+
+    //The caller keeps the event between calls, a word never outgrows a string reserved for maxWordLength
+    event.word.resize(length);
+    if (length > 0 && !file.read(event.word.data(), length)) {
+        return false;
+    }
+    offset += length;
+
+    tick += delta;
+    event.tick = tick;
+    event.row = row == LevelFormat::randomRow ? -1 : row;
+    event.speed = static_cast<float>(speedLow | speedHigh << 8) / LevelFormat::speedScale;
+    return true;
+}
+
+auto LevelReader::getPosition() const -> LevelPosition {
+    return {offset, tick};
+}
+
+auto LevelReader::seek(const LevelPosition& position) -> bool {
+    file.clear();
+    if (!file.seekg(static_cast<std::streamoff>(position.offset))) {
+        return false;
+    }
+    offset = position.offset;
+    tick = position.tick;
+    return true;
+}
+
+auto LevelReader::readByte(std::uint8_t& value) -> bool {
+    auto c = char(0);
+    if (!file.get(c)) {
+        return false;
+    }
+    value = static_cast<std::uint8_t>(c);
+    offset++;
+    return true;
+}
\ No newline at end of file
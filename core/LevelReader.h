@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+// A compiled level: a Header, then one record per spawn, in the order they are due.
+//   varint  ticks since the previous spawn (7 bits per byte, low bits first)
+//   uint8   row, 0 at the top, randomRow for a random one
+//   uint16  speed in hundredths of a pixel per tick, low byte first
+//   uint8   word length up to maxWordLength, 0 picks a word from the current package
+//   char[]  word
+// Scripts are compiled into this by LevelCompiler, see LevelCompiler.h for the script syntax.
+namespace LevelFormat {
+    constexpr std::array<char, 8> magic = {'M', 'T', 'L', 'E', 'V', 'E', 'L', '1'};
+    constexpr std::uint32_t version = 1;
+    constexpr int ticksPerSecond = 60;
+    constexpr int rowCount = 10;
+    constexpr std::uint8_t randomRow = 255;
+    constexpr std::size_t maxWordLength = 32;
+    constexpr float speedScale = 100.0f;
+
+    struct Header {
+        std::array<char, 8> magic;
+        std::uint32_t version;
+        std::uint32_t eventCount;
+    };
+}
+
+struct LevelEvent {
+    std::uint64_t tick = 0;
+    int row = -1;
+    float speed = 0.0f;
+    std::string word;
+};
+
+// Where reading continues, saved with a game so a restored level picks up mid-way.
+struct LevelPosition {
+    std::uint64_t offset = 0;
+    std::uint64_t tick = 0;
+};
+
+// Streams a compiled level one event at a time, only the file buffer and the event passed to next()
+// are ever held, so a level of any length plays in constant memory. The hash of the file's contents
+// tells saves apart that were made with another level, a position only means something in its own file.
+class LevelReader {
+public:
+    auto open(const std::string& path) -> bool;
+    auto isOpen() const -> bool;
+    auto getEventCount() const -> std::uint32_t;
+    auto getHash() const -> std::uint64_t;
+    auto rewind() -> void;
+    auto next(LevelEvent& event) -> bool;
+    auto getPosition() const -> LevelPosition;
+    auto seek(const LevelPosition& position) -> bool;
+
+private:
+    auto readByte(std::uint8_t& value) -> bool;
+
+    std::ifstream file;
+    std::uint32_t eventCount = 0;
+    std::uint64_t hash = 0;
+    std::uint64_t offset = 0;
+    std::uint64_t tick = 0;
+};
\ No newline at end of file
@@ -0,0 +1,103 @@
+#include "MarkovWordGenerator.h"
+#include <algorithm>
+#include <numeric>
+
+auto MarkovWordGenerator::train(const std::vector<std::string>& words) -> void {
+    symbolOf.fill(unknown);
+    letters.clear();
+    trainingWords.clear();
+
+    for (const auto& word : words) {
+        for (auto c : word) {
+            auto byte = static_cast<unsigned char>(c);
+            if (symbolOf[byte] == unknown && letters.size() < maxSymbols) {
+                symbolOf[byte] = static_cast<std::uint8_t>(letters.size());
+                letters.push_back(c);
+            }
+        }
+    }
+
+    //Letters are 0 .. boundary - 1, the boundary symbol marks both ends of a word
+    boundary = letters.size();
+    auto columns = boundary + 1;
+    pairCounts.assign(columns * columns * columns, 0);
+    singleCounts.assign(columns * columns, 0);
+
+    for (const auto& word : words) {
+        auto known = std::all_of(word.begin(), word.end(), [this](char c) {
+            return symbolOf[static_cast<unsigned char>(c)] != unknown;
+        });
+        if (word.empty() || !known) {
+            continue;
+        }
+        trainingWords.insert(word);
+
+        auto previous = boundary;
+        auto last = boundary;
+        for (auto i = std::size_t(0); i <= word.size(); i++) {
+            auto next = i < word.size() ? symbolOf[static_cast<unsigned char>(word[i])] : boundary;
+            pairCounts[(previous * columns + last) * columns + next]++;
+            singleCounts[last * columns + next]++;
+            previous = last;
+            last = next;
+        }
+    }
+
+    for (auto row = std::size_t(0); row < pairCounts.size(); row += columns) {
+        std::partial_sum(pairCounts.begin() + row, pairCounts.begin() + row + columns, pairCounts.begin() + row);
+    }
+    for (auto row = std::size_t(0); row < singleCounts.size(); row += columns) {
+        std::partial_sum(singleCounts.begin() + row, singleCounts.begin() + row + columns, singleCounts.begin() + row);
+    }
+}
+
+auto MarkovWordGenerator::generate(std::mt19937& generator, const int& minLength, const int& maxLength, std::string& out) const -> void {
+    //Words the player already knows from the package, or that were cut off by a length limit, are drawn again
+    for (auto attempt = 0; attempt < maxAttempts; attempt++) {
+        auto ended = generateOnce(generator, minLength, maxLength, out);
+        if (ended && out.size() >= minLength && !trainingWords.contains(out)) {
+            return;
+        }
+    }
+}
+
+auto MarkovWordGenerator::empty() const -> bool {
+    return trainingWords.empty();
+}
+
+auto MarkovWordGenerator::generateOnce(std::mt19937& generator, const int& minLength, const int& maxLength, std::string& out) const -> bool {
+    out.clear();
+    auto columns = boundary + 1;
+    auto previous = boundary;
+    auto last = boundary;
+
+    while (out.size() < maxLength) {
+        auto allowEnd = out.size() >= minLength;
+        auto next = sample(generator, &pairCounts[(previous * columns + last) * columns], allowEnd);
+        if (next < 0) {
+            next = sample(generator, &singleCounts[last * columns], allowEnd);
+        }
+        if (next < 0 || next == boundary) {
+            return next == boundary;
+        }
+
+        out += letters[next];
+        previous = last;
+        last = next;
+    }
+
+    //At the length limit, only keep words the training data could have ended here
+    const auto* cumulative = &pairCounts[(previous * columns + last) * columns];
+    return cumulative[boundary] > cumulative[boundary - 1];
+}
+
+auto MarkovWordGenerator::sample(std::mt19937& generator, const std::uint32_t* cumulative, const bool& allowEnd) const -> int {
+    //Leaving out the last column is enough to forbid ending the word here
+    auto total = allowEnd ? cumulative[boundary] : (boundary > 0 ? cumulative[boundary - 1] : 0);
+    if (total == 0) {
+        return -1;
+    }
+
+    auto target = std::uniform_int_distribution<std::uint32_t>(0, total - 1)(generator);
+    return static_cast<int>(std::upper_bound(cumulative, cumulative + boundary + 1, target) - cumulative);
+}
\ No newline at end of file
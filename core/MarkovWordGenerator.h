@@ -0,0 +1,38 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+// Character level Markov chain that makes up pronounceable pseudo-words in the style of
+// the words it was trained on. Each letter is drawn from counts conditioned on the two
+// letters before it, falling back to one letter of context when a pair was never seen.
+// The tables are flat cumulative counts built once by train(), generate() only does
+// table lookups and writes into a string the caller keeps around, so it never allocates
+// once that string has grown to maxLength.
+class MarkovWordGenerator {
+public:
+    static constexpr std::size_t maxSymbols = 63;
+    static constexpr int maxAttempts = 16;
+
+    auto train(const std::vector<std::string>& words) -> void;
+    auto generate(std::mt19937& generator, const int& minLength, const int& maxLength, std::string& out) const -> void;
+    auto empty() const -> bool;
+
+private:
+    auto generateOnce(std::mt19937& generator, const int& minLength, const int& maxLength, std::string& out) const -> bool;
+    auto sample(std::mt19937& generator, const std::uint32_t* cumulative, const bool& allowEnd) const -> int;
+
+    static constexpr std::uint8_t unknown = 0xFF;
+
+    std::array<std::uint8_t, 256> symbolOf = {};
+    std::vector<char> letters;
+    std::size_t boundary = 0;
+    //Rows of boundary + 1 cumulative counts, the last column is the end of the word
+    std::vector<std::uint32_t> pairCounts;
+    std::vector<std::uint32_t> singleCounts;
+    std::unordered_set<std::string> trainingWords;
+};
\ No newline at end of file
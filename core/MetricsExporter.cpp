@@ -0,0 +1,182 @@
+#include "MetricsExporter.h"
+#include <fstream>
+#include <fmt/format.h>
+
+#ifndef _WIN32
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    auto residentMemoryBytes() -> long long {
+        //Linux only, second field of statm is the resident set in pages
+        auto statm = std::ifstream("/proc/self/statm");
+        auto size = 0ll;
+        auto resident = 0ll;
+        if (statm >> size >> resident) {
+#ifndef _WIN32
+            return resident * sysconf(_SC_PAGESIZE);
+#endif
+        }
+        return 0;
+    }
+
+    auto appendHistogram(std::string& out, const std::string& name, const std::string& help, const AtomicHistogram& histogram) -> void {
+        out += fmt::format("# HELP {} {}\n# TYPE {} histogram\n", name, help, name);
+
+        auto cumulative = std::uint64_t(0);
+        for (auto i = 0; i < AtomicHistogram::bounds.size(); i++) {
+            cumulative += histogram.bucketCount(i);
+            out += fmt::format("{}_bucket{{le=\"{}\"}} {}\n", name, AtomicHistogram::bounds[i] / 1000.0, cumulative);
+        }
+        cumulative += histogram.bucketCount(AtomicHistogram::bounds.size());
+        out += fmt::format("{}_bucket{{le=\"+Inf\"}} {}\n", name, cumulative);
+        out += fmt::format("{}_sum {}\n{}_count {}\n", name, histogram.sumMs() / 1000.0, name, cumulative);
+
+        out += fmt::format("# TYPE {}_quantile gauge\n", name);
+        for (auto quantile : {0.5, 0.9, 0.99}) {
+            out += fmt::format("{}_quantile{{quantile=\"{}\"}} {}\n", name, quantile, histogram.percentile(quantile) / 1000.0);
+        }
+    }
+}
+
+MetricsExporter::MetricsExporter(const GameMetrics& metrics) : metrics(metrics) {}
+
+MetricsExporter::~MetricsExporter() {
+    if (thread.joinable()) {
+        thread.request_stop();
+        thread.join();
+    }
+#ifndef _WIN32
+    if (listenSocket >= 0) {
+        close(listenSocket);
+    }
+    if (!unixPath.empty()) {
+        unlink(unixPath.c_str());
+    }
+#endif
+}
+
+auto MetricsExporter::startTcp(const unsigned short& port) -> bool {
+#ifdef _WIN32
+    fmt::print(stderr, "Metrics exporter is not supported on this platform\n");
+    return false;
+#else
+    listenSocket = socket(AF_INET, SOCK_STREAM, 0);
+    if (listenSocket < 0) {
+        return false;
+    }
+
+    auto reuse = 1;
+    setsockopt(listenSocket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    auto address = sockaddr_in();
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    if (bind(listenSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(listenSocket, 4) != 0) {
+        fmt::print(stderr, "Could not listen for metrics on 127.0.0.1:{}\n", port);
+        close(listenSocket);
+        listenSocket = -1;
+        return false;
+    }
+
+    thread = std::jthread([this](std::stop_token stopToken) {serve(stopToken);});
+    return true;
+#endif
+}
+
+auto MetricsExporter::startUnix(const std::string& path) -> bool {
+#ifdef _WIN32
+    fmt::print(stderr, "Metrics exporter is not supported on this platform\n");
+    return false;
+#else
+    auto address = sockaddr_un();
+    if (path.size() >= sizeof(address.sun_path)) {
+        return false;
+    }
+
+    listenSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenSocket < 0) {
+        return false;
+    }
+
+    address.sun_family = AF_UNIX;
+    path.copy(address.sun_path, path.size());
+    unlink(path.c_str());
+
+    if (bind(listenSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(listenSocket, 4) != 0) {
+        fmt::print(stderr, "Could not listen for metrics on {}\n", path);
+        close(listenSocket);
+        listenSocket = -1;
+        return false;
+    }
+    unixPath = path;
+
+    thread = std::jthread([this](std::stop_token stopToken) {serve(stopToken);});
+    return true;
+#endif
+}
+
+auto MetricsExporter::serve(std::stop_token stopToken) -> void {
+#ifndef _WIN32
+    while (!stopToken.stop_requested()) {
+        //Wake up regularly so a stop request is noticed without a connection
+        auto descriptor = pollfd{listenSocket, POLLIN, 0};
+        if (poll(&descriptor, 1, 200) <= 0) {
+            continue;
+        }
+
+        auto client = accept(listenSocket, nullptr, nullptr);
+        if (client < 0) {
+            continue;
+        }
+
+        //The request itself is irrelevant, drain what has arrived so the peer sees a clean close
+        char request[1024];
+        auto clientDescriptor = pollfd{client, POLLIN, 0};
+        if (poll(&clientDescriptor, 1, 50) > 0) {
+            recv(client, request, sizeof(request), 0);
+        }
+
+        auto body = format();
+        auto response = fmt::format("HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\nContent-Length: {}\r\n\r\n{}",
+                                    body.size(), body);
+        //A scraper that stops reading must not hold the thread past a stop request, a timed out send gives up on it
+        auto timeout = timeval{1, 0};
+        setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+        auto sent = std::size_t(0);
+        while (sent < response.size() && !stopToken.stop_requested()) {
+            auto result = send(client, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+            if (result <= 0) {
+                break;
+            }
+            sent += result;
+        }
+        close(client);
+    }
+#endif
+}
+
+auto MetricsExporter::format() const -> std::string {
+    auto out = std::string();
+    appendHistogram(out, "monkeytyper_frame_time_seconds", "Time between presented frames.", metrics.frameTime);
+    appendHistogram(out, "monkeytyper_input_latency_seconds", "Time from polling a key event to the simulation handling it.", metrics.inputLatency);
+
+    out += fmt::format("# TYPE monkeytyper_frames_total counter\nmonkeytyper_frames_total {}\n", metrics.frames.load(std::memory_order_relaxed));
+    out += fmt::format("# TYPE monkeytyper_ticks_total counter\nmonkeytyper_ticks_total {}\n", metrics.ticks.load(std::memory_order_relaxed));
+    out += fmt::format("# TYPE monkeytyper_words_spawned_total counter\nmonkeytyper_words_spawned_total {}\n", metrics.wordsSpawned.load(std::memory_order_relaxed));
+    out += fmt::format("# TYPE monkeytyper_spawn_interval_seconds gauge\nmonkeytyper_spawn_interval_seconds {}\n", metrics.spawnIntervalSeconds.load(std::memory_order_relaxed));
+    out += fmt::format("# TYPE monkeytyper_live_words gauge\nmonkeytyper_live_words {}\n", metrics.liveWords.load(std::memory_order_relaxed));
+    out += fmt::format("# TYPE monkeytyper_score gauge\nmonkeytyper_score {}\n", metrics.score.load(std::memory_order_relaxed));
+    out += fmt::format("# TYPE monkeytyper_health gauge\nmonkeytyper_health {}\n", metrics.health.load(std::memory_order_relaxed));
+    out += fmt::format("# TYPE monkeytyper_game_state gauge\nmonkeytyper_game_state {}\n", metrics.gameState.load(std::memory_order_relaxed));
+    out += fmt::format("# TYPE monkeytyper_resident_memory_bytes gauge\nmonkeytyper_resident_memory_bytes {}\n", residentMemoryBytes());
+    return out;
+}
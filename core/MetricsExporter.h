@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+#include <thread>
+#include "GameMetrics.h"
+
+// Serves GameMetrics in the Prometheus text format from a background thread, either on
+// a localhost TCP port or on a Unix domain socket. Every connection gets one response.
+class MetricsExporter {
+public:
+    explicit MetricsExporter(const GameMetrics& metrics);
+    ~MetricsExporter();
+
+    auto startTcp(const unsigned short& port) -> bool;
+    auto startUnix(const std::string& path) -> bool;
+
+private:
+    auto serve(std::stop_token stopToken) -> void;
+    auto format() const -> std::string;
+
+    const GameMetrics& metrics;
+    int listenSocket = -1;
+    std::string unixPath;
+    std::jthread thread;
+};
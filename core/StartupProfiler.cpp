@@ -0,0 +1,25 @@
+#include "StartupProfiler.h"
+#include <thread>
+#include <fmt/format.h>
+
+StartupProfiler::StartupProfiler() : start(std::chrono::steady_clock::now()) {}
+
+auto StartupProfiler::now() const -> std::chrono::steady_clock::time_point {
+    return std::chrono::steady_clock::now();
+}
+
+auto StartupProfiler::record(const std::string& step, const std::chrono::steady_clock::time_point& stepStart) -> void {
+    auto finished = now();
+    auto took = std::chrono::duration<double, std::milli>(finished - stepStart).count();
+    auto at = std::chrono::duration<double, std::milli>(finished - start).count();
+
+    auto lock = std::lock_guard(mutex);
+    fmt::print(stderr, "[startup] {:<24} {:8.1f} ms (done at {:.1f} ms)\n", step, took, at);
+}
+
+auto StartupProfiler::milestone(const std::string& name) -> void {
+    auto at = std::chrono::duration<double, std::milli>(now() - start).count();
+
+    auto lock = std::lock_guard(mutex);
+    fmt::print(stderr, "[startup] {:<24} {:8.1f} ms\n", name, at);
+}
\ No newline at end of file
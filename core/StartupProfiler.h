@@ -0,0 +1,20 @@
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <string>
+
+// Logs how long startup steps take, measured from construction. Safe to use from the
+// worker threads that decode assets.
+class StartupProfiler {
+public:
+    StartupProfiler();
+
+    auto now() const -> std::chrono::steady_clock::time_point;
+    auto record(const std::string& step, const std::chrono::steady_clock::time_point& stepStart) -> void;
+    auto milestone(const std::string& name) -> void;
+
+private:
+    std::chrono::steady_clock::time_point start;
+    std::mutex mutex;
+};
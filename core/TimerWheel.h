@@ -0,0 +1,110 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// Hashed timing wheel driven by a tick counter. A timer lives in the slot for its due tick
+// modulo SlotCount, so advancing one tick only walks that slot instead of every pending timer.
+// Timers further away than one revolution share the slot and are skipped until their tick
+// comes round. Nodes come from a pool sized up front, scheduling never allocates.
+template <typename T, std::size_t SlotCount = 256>
+class TimerWheel {
+public:
+    explicit TimerWheel(const std::size_t& capacity) : nodes(capacity) {
+        reset(0);
+    }
+
+    auto reset(const std::uint64_t& tick) -> void {
+        slots.fill(none);
+        for (auto i = std::size_t(0); i < nodes.size(); i++) {
+            nodes[i].next = i + 1 < nodes.size() ? static_cast<std::int32_t>(i + 1) : none;
+        }
+        freeList = nodes.empty() ? none : 0;
+        count = 0;
+        currentTick = tick;
+    }
+
+    auto schedule(const std::uint64_t& dueTick, const T& payload) -> bool {
+        if (freeList == none) {
+            return false;
+        }
+
+        //Anything already due fires on the next tick rather than being lost
+        auto tick = dueTick > currentTick ? dueTick : currentTick + 1;
+        auto index = freeList;
+        auto& node = nodes[index];
+        freeList = node.next;
+
+        auto& slot = slots[tick % SlotCount];
+        node.dueTick = tick;
+        node.payload = payload;
+        node.next = slot;
+        slot = index;
+        count++;
+        return true;
+    }
+
+    //Fires every timer due up to and including tick, callbacks may schedule new timers
+    template <typename Callback>
+    auto advance(const std::uint64_t& tick, Callback&& fire) -> void {
+        while (currentTick < tick) {
+            currentTick++;
+
+            auto due = none;
+            auto* link = &slots[currentTick % SlotCount];
+            while (*link != none) {
+                auto index = *link;
+                if (nodes[index].dueTick == currentTick) {
+                    *link = nodes[index].next;
+                    nodes[index].next = due;
+                    due = index;
+                } else {
+                    link = &nodes[index].next;
+                }
+            }
+
+            while (due != none) {
+                auto index = due;
+                due = nodes[index].next;
+                auto payload = nodes[index].payload;
+                nodes[index].next = freeList;
+                freeList = index;
+                count--;
+                fire(payload);
+            }
+        }
+    }
+
+    template <typename Visitor>
+    auto forEach(Visitor&& visit) const -> void {
+        for (const auto& head : slots) {
+            for (auto index = head; index != none; index = nodes[index].next) {
+                visit(nodes[index].dueTick, nodes[index].payload);
+            }
+        }
+    }
+
+    auto size() const -> std::size_t {
+        return count;
+    }
+
+    auto getTick() const -> std::uint64_t {
+        return currentTick;
+    }
+
+private:
+    static constexpr std::int32_t none = -1;
+
+    struct Node {
+        std::uint64_t dueTick = 0;
+        T payload{};
+        std::int32_t next = none;
+    };
+
+    std::vector<Node> nodes;
+    std::array<std::int32_t, SlotCount> slots;
+    std::int32_t freeList = none;
+    std::size_t count = 0;
+    std::uint64_t currentTick = 0;
+};
\ No newline at end of file
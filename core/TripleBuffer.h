@@ -0,0 +1,52 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+// Single producer / single consumer triple buffer. The writer always owns one slot,
+// the reader owns another and the third is exchanged atomically between them, so
+// neither side ever waits for the other.
+template <typename T>
+class TripleBuffer {
+public:
+    auto writeBuffer() -> T& {
+        return buffers[backIndex];
+    }
+
+    auto publish() -> void {
+        auto previous = state.exchange(static_cast<std::uint8_t>(backIndex | dirtyBit), std::memory_order_acq_rel);
+        backIndex = previous & indexMask;
+    }
+
+    auto update() -> bool {
+        if ((state.load(std::memory_order_relaxed) & dirtyBit) == 0) {
+            return false;
+        }
+
+        auto previous = state.exchange(frontIndex, std::memory_order_acq_rel);
+        frontIndex = previous & indexMask;
+        return true;
+    }
+
+    auto readBuffer() const -> const T& {
+        return buffers[frontIndex];
+    }
+
+    //Only for setting up the buffers, e.g. reserving capacity, before either thread uses them
+    template <typename Function>
+    auto forEachBuffer(Function&& function) -> void {
+        for (auto& buffer : buffers) {
+            function(buffer);
+        }
+    }
+
+private:
+    static constexpr std::uint8_t indexMask = 0x3;
+    static constexpr std::uint8_t dirtyBit = 0x4;
+
+    std::array<T, 3> buffers;
+    std::atomic<std::uint8_t> state = 1;
+    std::uint8_t backIndex = 0;
+    std::uint8_t frontIndex = 2;
+};
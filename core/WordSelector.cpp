@@ -0,0 +1,69 @@
+#include "WordSelector.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+auto WordSelector::rebuild(const std::vector<std::string>& wordList, const Difficulty& difficulty) -> void {
+    table.build(getWeights(wordList, difficulty));
+
+    //A window as large as the list would leave nothing to pick
+    window = std::min(repeatWindow, wordList.empty() ? 0 : wordList.size() - 1);
+    recentCount = 0;
+    recentNext = 0;
+}
+
+auto WordSelector::next(std::mt19937& generator) -> std::size_t {
+    auto index = table.sample(generator);
+    for (auto attempt = 0; attempt < maxRedraws && isRecent(index); attempt++) {
+        index = table.sample(generator);
+    }
+
+    if (window > 0) {
+        recent[recentNext] = index;
+        recentNext = (recentNext + 1) % window;
+        recentCount = std::min(recentCount + 1, window);
+    }
+    return index;
+}
+
+auto WordSelector::empty() const -> bool {
+    return table.empty();
+}
+
+auto WordSelector::getWeights(const std::vector<std::string>& wordList, const Difficulty& difficulty) -> std::vector<double> {
+    auto letterCounts = std::array<double, 256>();
+    auto totalLetters = 0.0;
+    for (const auto& word : wordList) {
+        for (auto c : word) {
+            letterCounts[static_cast<unsigned char>(c)]++;
+            totalLetters++;
+        }
+    }
+
+    //Complexity is the total surprise of the word's letters in bits, so it grows with length and rarity
+    auto complexity = std::vector<double>(wordList.size());
+    for (auto i = std::size_t(0); i < wordList.size(); i++) {
+        for (auto c : wordList[i]) {
+            complexity[i] -= std::log2(letterCounts[static_cast<unsigned char>(c)] / totalLetters);
+        }
+    }
+
+    auto exponent = 0.0;
+    switch (difficulty) {
+        case Difficulty::Easy: exponent = -3.0; break;
+        case Difficulty::Medium: exponent = 0.0; break;
+        case Difficulty::Hard: exponent = 3.0; break;
+    }
+
+    //Relative to the mean so the exponent cannot overflow on long words
+    auto mean = wordList.empty() ? 1.0 : std::max(1e-9, std::accumulate(complexity.begin(), complexity.end(), 0.0) / complexity.size());
+    auto weights = std::vector<double>(wordList.size());
+    for (auto i = std::size_t(0); i < wordList.size(); i++) {
+        weights[i] = complexity[i] > 0.0 ? std::pow(complexity[i] / mean, exponent) : 0.0;
+    }
+    return weights;
+}
+
+auto WordSelector::isRecent(const std::size_t& index) const -> bool {
+    return std::find(recent.begin(), recent.begin() + recentCount, index) != recent.begin() + recentCount;
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include "AliasTable.h"
+#include "../enums/Difficulty.h"
+
+// Chooses which word spawns next. Every word gets a weight from its length and how rare
+// its letters are within the package, skewed towards short common words on Easy and long
+// rare ones on Hard. The weights go into an alias table, rebuilt only when the word list
+// or difficulty changes, so each pick is O(1). Recently picked words are redrawn.
+class WordSelector {
+public:
+    static constexpr std::size_t repeatWindow = 8;
+    static constexpr int maxRedraws = 8;
+
+    auto rebuild(const std::vector<std::string>& wordList, const Difficulty& difficulty) -> void;
+    auto next(std::mt19937& generator) -> std::size_t;
+    auto empty() const -> bool;
+
+private:
+    static auto getWeights(const std::vector<std::string>& wordList, const Difficulty& difficulty) -> std::vector<double>;
+    auto isRecent(const std::size_t& index) const -> bool;
+
+    AliasTable table;
+    std::array<std::size_t, repeatWindow> recent = {};
+    std::size_t window = 0;
+    std::size_t recentCount = 0;
+    std::size_t recentNext = 0;
+};
\ No newline at end of file
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstdint>
+
+enum class AllocationPhase : std::uint8_t {
+    Other,
+    Events,
+    Input,
+    Update,
+    Snapshot,
+    Render,
+    Present
+};
\ No newline at end of file
@@ -0,0 +1,7 @@
+#pragma once
+
+enum class FramePacing {
+    VSync,
+    Capped,
+    Uncapped
+}; 
\ No newline at end of file
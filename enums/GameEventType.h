@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstdint>
+
+enum class GameEventType : std::uint8_t {
+    Spawn,
+    Hit,
+    Miss,
+    Damage,
+    Pause,
+    Resume,
+    StateChange
+};
\ No newline at end of file
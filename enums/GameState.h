@@ -8,6 +8,8 @@ enum class GameState {
     SettingsDifficulty,
     SettingsWordPackage,
     SettingsFont,
+    SettingsFramePacing,
+    SettingsTypoTolerance,
     Leaderboard,
     Pause
 }; 
\ No newline at end of file
@@ -0,0 +1,8 @@
+#pragma once
+
+#include <cstdint>
+
+enum class ScheduledEvent : std::uint8_t {
+    Spawn,
+    LevelSpawn
+};
\ No newline at end of file
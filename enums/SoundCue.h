@@ -0,0 +1,7 @@
+#pragma once
+
+enum class SoundCue {
+    Hit,
+    Miss,
+    Damage
+}; 
\ No newline at end of file
@@ -0,0 +1,8 @@
+#pragma once
+
+enum class SubmitResult {
+    Empty,
+    Hit,
+    NearHit,
+    Miss
+}; 
\ No newline at end of file
@@ -2,5 +2,6 @@
 
 enum class WordPackage {
     English,
-    Polish
+    Polish,
+    Generated
 }; 
\ No newline at end of file
@@ -1,7 +1,81 @@
 #include "Game.h"
+#include <charconv>
+#include <fmt/format.h>
 
-int main() {
-    Game game;
-    game.run();
-    return 0;
+//Digits only and within [min, max], anything longer or larger is rejected instead of wrapping
+template <typename T>
+auto parseNumber(const std::string& value, const T& min, const T& max, T& result) -> bool {
+    auto number = 0ull;
+    auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), number);
+    if (error != std::errc() || end != value.data() + value.size() || number < min || number > max) {
+        return false;
+    }
+    result = static_cast<T>(number);
+    return true;
 }
+
+auto printUsage(const std::string& error) -> bool {
+    fmt::print(stderr, "{}\n", error);
+    fmt::print(stderr, "Usage: MonkeyTyper [--pacing=vsync|capped|uncapped] [--fps=1-{}]\n"
+                        "                   [--metrics-port=1-65535 | --metrics-socket=PATH] [--event-log=PATH]\n"
+                        "                   [--alloc-guard] [--lanes=1-{}] [--level=PATH]\n", GameOptions::maxTargetFps, GameOptions::maxLanes);
+    return false;
+}
+
+auto parseGameOptions(int argc, char** argv, GameOptions& options) -> bool {
+    for (auto i = 1; i < argc; i++) {
+        auto argument = std::string(argv[i]);
+        auto separator = argument.find('=');
+        auto key = argument.substr(0, separator);
+        auto value = separator == std::string::npos ? std::string() : argument.substr(separator + 1);
+
+        if (key == "--pacing" && value == "vsync") {
+            options.framePacing = FramePacing::VSync;
+        } else if (key == "--pacing" && value == "capped") {
+            options.framePacing = FramePacing::Capped;
+        } else if (key == "--pacing" && value == "uncapped") {
+            options.framePacing = FramePacing::Uncapped;
+        } else if (key == "--fps") {
+            if (!parseNumber(value, 1u, GameOptions::maxTargetFps, options.targetFps)) {
+                return printUsage(fmt::format("--fps takes a number from 1 to {}: {}", GameOptions::maxTargetFps, argument));
+            }
+        } else if (key == "--metrics-port") {
+            if (!parseNumber<unsigned short>(value, 1, 65535, options.metricsPort)) {
+                return printUsage(fmt::format("--metrics-port takes a port from 1 to 65535: {}", argument));
+            }
+        } else if (key == "--metrics-socket" && !value.empty()) {
+            options.metricsSocket = value;
+        } else if (key == "--event-log" && !value.empty()) {
+            options.eventLogPath = value;
+        } else if (key == "--alloc-guard" && value.empty()) {
+            options.allocationGuard = true;
+        } else if (key == "--lanes" && value.size() == 1 && value[0] >= '1' && value[0] <= '0' + GameOptions::maxLanes) {
+            options.lanes = value[0] - '0';
+        } else if (key == "--level" && !value.empty()) {
+            options.levelPath = value;
+        } else {
+            return printUsage(fmt::format("Unknown option: {}", argument));
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    auto options = GameOptions();
+    if (!parseGameOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    if (options.allocationGuard && !AllocationTracker::isEnabled()) {
+        fmt::print(stderr, "--alloc-guard needs a build configured with MONKEYTYPER_TRACK_ALLOCATIONS=ON\n");
+        return 1;
+    }
+
+    if (!options.levelPath.empty() && !LevelReader().open(options.levelPath)) {
+        fmt::print(stderr, "{} is not a compiled level, see monkeytyper_compile_level\n", options.levelPath);
+        return 1;
+    }
+
+    Game game(options);
+    return game.run();
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+#include "Typist.h"
+#include <algorithm>
+#include <cmath>
+
+Typist::Typist(const TypistProfile& profile, const unsigned int& seed)
+    : profile(profile),
+      generator(seed),
+      reactionDist(profile.reactionMeanMs, profile.reactionStdDevMs),
+      errorDist(std::clamp(profile.errorRate, 0.0f, 1.0f)),
+      letterDist('a', 'z') {}
+
+auto Typist::act(GameSession& session) -> void {
+    if (!target.empty() && !isTargetAlive(session)) {
+        for (auto i = 0; i < typed; i++) {
+            session.backspace();
+        }
+        target.clear();
+    }
+
+    if (target.empty()) {
+        pickTarget(session);
+        if (target.empty()) {
+            return;
+        }
+    }
+
+    if (reactionTicks > 0) {
+        reactionTicks--;
+        return;
+    }
+
+    //A "word" is five keystrokes when measuring WPM
+    keystrokeBudget += profile.wordsPerMinute * 5.0f / 60.0f / GameSession::tickRate;
+
+    while (keystrokeBudget >= 1.0f && typed < target.size()) {
+        auto c = target[typed];
+        if (errorDist(generator)) {
+            auto wrong = static_cast<char>(letterDist(generator));
+            c = wrong == c ? static_cast<char>('a' + (c - 'a' + 1) % 26) : wrong;
+        }
+        session.typeCharacter(c);
+        typed++;
+        stats.keystrokes++;
+        keystrokeBudget -= 1.0f;
+    }
+
+    if (typed == target.size() && keystrokeBudget >= 1.0f) {
+        keystrokeBudget -= 1.0f;
+        stats.keystrokes++;
+        if (session.submit() != SubmitResult::Miss) {
+            stats.hits++;
+        } else {
+            stats.misses++;
+        }
+        target.clear();
+    }
+}
+
+auto Typist::getStats() const -> const TypistStats& {
+    return stats;
+}
+
+auto Typist::pickTarget(const GameSession& session) -> void {
+    const auto& words = session.getWords();
+    auto iterator = std::max_element(words.begin(), words.end(),
+        [](const Word& a, const Word& b) {return a.getPosition().x < b.getPosition().x;});
+
+    if (iterator == words.end()) {
+        return;
+    }
+
+    target = iterator->getText();
+    typed = 0;
+    keystrokeBudget = 0.0f;
+    auto reactionMs = std::max(0.0f, reactionDist(generator));
+    reactionTicks = static_cast<int>(std::lround(reactionMs / 1000.0f * GameSession::tickRate));
+}
+
+auto Typist::isTargetAlive(const GameSession& session) const -> bool {
+    const auto& words = session.getWords();
+    return std::any_of(words.begin(), words.end(),
+        [this](const Word& word) {return word.getText() == target;});
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <random>
+#include <string>
+#include "../GameSession.h"
+
+struct TypistProfile {
+    float wordsPerMinute = 60.0f;
+    float errorRate = 0.02f;
+    float reactionMeanMs = 300.0f;
+    float reactionStdDevMs = 80.0f;
+};
+
+struct TypistStats {
+    int hits = 0;
+    int misses = 0;
+    int keystrokes = 0;
+};
+
+// Synthetic player: picks the word closest to the edge, waits a sampled reaction time,
+// then types it at a fixed rate, occasionally hitting a wrong key.
+class Typist {
+public:
+    Typist(const TypistProfile& profile, const unsigned int& seed);
+    auto act(GameSession& session) -> void;
+    auto getStats() const -> const TypistStats&;
+
+private:
+    auto pickTarget(const GameSession& session) -> void;
+    auto isTargetAlive(const GameSession& session) const -> bool;
+
+    TypistProfile profile;
+    std::mt19937 generator;
+    std::normal_distribution<float> reactionDist;
+    std::bernoulli_distribution errorDist;
+    std::uniform_int_distribution<> letterDist;
+    TypistStats stats;
+    std::string target;
+    std::size_t typed = 0;
+    int reactionTicks = 0;
+    float keystrokeBudget = 0.0f;
+};
@@ -0,0 +1,87 @@
+#include "WorkStealingPool.h"
+
+WorkStealingPool::WorkStealingPool(const unsigned int& threadCount) {
+    auto count = std::max(1u, threadCount);
+    for (auto i = 0u; i < count; i++) {
+        queues.push_back(std::make_unique<Queue>());
+    }
+    for (auto i = 0u; i < count; i++) {
+        workers.emplace_back([this, i](std::stop_token stopToken) {
+            workerLoop(i, stopToken);
+        });
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    for (auto& worker : workers) {
+        worker.request_stop();
+    }
+    workAvailable.notify_all();
+}
+
+auto WorkStealingPool::submit(std::function<void()> task) -> void {
+    pending++;
+    auto& queue = *queues[nextQueue++ % queues.size()];
+    {
+        auto lock = std::lock_guard(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+    }
+    queued++;
+
+    auto lock = std::lock_guard(waitMutex);
+    workAvailable.notify_one();
+}
+
+auto WorkStealingPool::wait() -> void {
+    auto lock = std::unique_lock(waitMutex);
+    allDone.wait(lock, [this] {return pending.load() == 0;});
+}
+
+auto WorkStealingPool::getThreadCount() const -> unsigned int {
+    return static_cast<unsigned int>(workers.size());
+}
+
+auto WorkStealingPool::workerLoop(const unsigned int& index, std::stop_token stopToken) -> void {
+    auto task = std::function<void()>();
+
+    while (!stopToken.stop_requested()) {
+        if (tryPop(index, task)) {
+            task();
+            task = nullptr;
+
+            if (--pending == 0) {
+                auto lock = std::lock_guard(waitMutex);
+                allDone.notify_all();
+            }
+            continue;
+        }
+
+        auto lock = std::unique_lock(waitMutex);
+        workAvailable.wait(lock, stopToken, [this] {return queued.load() > 0;});
+    }
+}
+
+auto WorkStealingPool::tryPop(const unsigned int& index, std::function<void()>& task) -> bool {
+    {
+        auto& own = *queues[index];
+        auto lock = std::lock_guard(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            queued--;
+            return true;
+        }
+    }
+
+    for (auto offset = 1u; offset < queues.size(); offset++) {
+        auto& victim = *queues[(index + offset) % queues.size()];
+        auto lock = std::lock_guard(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            queued--;
+            return true;
+        }
+    }
+    return false;
+}
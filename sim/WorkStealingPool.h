@@ -0,0 +1,40 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Every worker owns a deque: it pops its own work from the back and, when that runs dry,
+// steals from the front of the other workers' deques.
+class WorkStealingPool {
+public:
+    explicit WorkStealingPool(const unsigned int& threadCount);
+    ~WorkStealingPool();
+
+    auto submit(std::function<void()> task) -> void;
+    auto wait() -> void;
+    auto getThreadCount() const -> unsigned int;
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    auto workerLoop(const unsigned int& index, std::stop_token stopToken) -> void;
+    auto tryPop(const unsigned int& index, std::function<void()>& task) -> bool;
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::atomic<std::size_t> nextQueue = 0;
+    std::atomic<std::size_t> queued = 0;
+    std::atomic<std::size_t> pending = 0;
+    std::mutex waitMutex;
+    std::condition_variable_any workAvailable;
+    std::condition_variable allDone;
+    std::vector<std::jthread> workers;
+};
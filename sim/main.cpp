@@ -0,0 +1,365 @@
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+#include "Typist.h"
+#include "WorkStealingPool.h"
+#include "../GameSession.h"
+#include "../core/EventLog.h"
+
+// Headless batch runner used to tune the difficulty parameters, e.g.
+// monkeytyper_sim --sessions=2000 --difficulty=easy,medium,hard --wpm=40,60,80 --format=json
+
+struct SimulationConfig {
+    Difficulty difficulty;
+    TypistProfile profile;
+    int typoTolerance;
+};
+
+struct SessionResult {
+    float survivalSeconds = 0.0f;
+    int score = 0;
+    int hits = 0;
+    int misses = 0;
+    bool survived = false;
+};
+
+struct Options {
+    int sessions = 1000;
+    float maxSeconds = 600.0f;
+    unsigned int threads = std::thread::hardware_concurrency();
+    unsigned int seed = 1;
+    std::string format = "csv";
+    std::string package = "assets/packages/words_english.txt";
+    std::string output;
+    std::string eventLog;
+    std::string level;
+    bool generated = false;
+    std::vector<Difficulty> difficulties = {Difficulty::Easy, Difficulty::Medium, Difficulty::Hard};
+    std::vector<float> wordsPerMinute = {60.0f};
+    std::vector<float> errorRates = {0.02f};
+    std::vector<float> reactionMeansMs = {300.0f};
+    float reactionStdDevMs = 80.0f;
+    int typoTolerance = 0;
+};
+
+auto split(const std::string& value) -> std::vector<std::string> {
+    auto parts = std::vector<std::string>();
+    auto start = std::size_t(0);
+    while (start <= value.size()) {
+        auto end = value.find(',', start);
+        if (end == std::string::npos) {
+            end = value.size();
+        }
+        parts.push_back(value.substr(start, end - start));
+        start = end + 1;
+    }
+    return parts;
+}
+
+auto parseFloats(const std::string& value) -> std::vector<float> {
+    auto values = std::vector<float>();
+    for (const auto& part : split(value)) {
+        values.push_back(std::stof(part));
+    }
+    return values;
+}
+
+auto parseDifficulty(const std::string& value) -> Difficulty {
+    if (value == "easy") return Difficulty::Easy;
+    if (value == "medium") return Difficulty::Medium;
+    if (value == "hard") return Difficulty::Hard;
+    throw std::invalid_argument("unknown difficulty: " + value);
+}
+
+auto difficultyName(const Difficulty& difficulty) -> std::string {
+    switch (difficulty) {
+        case Difficulty::Easy: return "easy";
+        case Difficulty::Medium: return "medium";
+        case Difficulty::Hard: return "hard";
+        default: return "easy";
+    }
+}
+
+//Counts that size the run must be positive, a negative one would wrap into a huge size_t later
+auto parsePositive(const std::string& key, const std::string& value) -> int {
+    auto number = std::stoi(value);
+    if (number <= 0) {
+        throw std::invalid_argument(key + " must be positive: " + value);
+    }
+    return number;
+}
+
+auto parseOptions(int argc, char** argv) -> Options {
+    auto options = Options();
+    for (auto i = 1; i < argc; i++) {
+        auto argument = std::string(argv[i]);
+        auto separator = argument.find('=');
+        auto key = argument.substr(0, separator);
+        auto value = separator == std::string::npos ? std::string() : argument.substr(separator + 1);
+
+        if (key == "--sessions") options.sessions = parsePositive(key, value);
+        else if (key == "--max-seconds") {
+            options.maxSeconds = std::stof(value);
+            if (!(options.maxSeconds > 0.0f)) {
+                throw std::invalid_argument(key + " must be positive: " + value);
+            }
+        }
+        else if (key == "--threads") options.threads = parsePositive(key, value);
+        else if (key == "--seed") options.seed = std::stoul(value);
+        else if (key == "--format") options.format = value;
+        else if (key == "--package") options.package = value;
+        else if (key == "--output") options.output = value;
+        else if (key == "--event-log") options.eventLog = value;
+        else if (key == "--level") options.level = value;
+        else if (key == "--generated") options.generated = true;
+        else if (key == "--wpm") options.wordsPerMinute = parseFloats(value);
+        else if (key == "--error-rate") options.errorRates = parseFloats(value);
+        else if (key == "--reaction-ms") options.reactionMeansMs = parseFloats(value);
+        else if (key == "--reaction-stddev-ms") options.reactionStdDevMs = std::stof(value);
+        else if (key == "--typo-tolerance") options.typoTolerance = std::stoi(value);
+        else if (key == "--difficulty") {
+            options.difficulties.clear();
+            for (const auto& part : split(value)) {
+                options.difficulties.push_back(parseDifficulty(part));
+            }
+        }
+        else throw std::invalid_argument("unknown option: " + key);
+    }
+    return options;
+}
+
+auto loadWordList(const std::string& filename) -> std::vector<std::string> {
+    auto wordList = std::vector<std::string>();
+    auto file = std::fstream(filename);
+    auto word = std::string();
+
+    while (file >> word) {
+        wordList.push_back(word);
+    }
+    return wordList;
+}
+
+auto runSession(const SimulationConfig& config,
+                const std::vector<std::string>& wordList,
+                const float& maxSeconds,
+                const unsigned int& seed,
+                const MarkovWordGenerator* wordGenerator,
+                EventLog* eventLog,
+                const std::uint32_t& sessionId,
+                const std::string& levelPath) -> SessionResult {
+    auto session = GameSession(wordList, config.difficulty, seed, 800.0f);
+
+    //Each session streams the level through its own reader, setting it replaces the random spawns
+    auto level = LevelReader();
+    if (!levelPath.empty() && level.open(levelPath)) {
+        session.setLevel(&level);
+        session.reset(config.difficulty);
+    }
+    session.setTypoTolerance(config.typoTolerance);
+    session.setWordGenerator(wordGenerator);
+    session.setEventLog(eventLog, sessionId);
+    auto typist = Typist(config.profile, seed ^ 0x9e3779b9u);
+    auto maxTicks = static_cast<std::uint64_t>(maxSeconds * GameSession::tickRate);
+
+    while (!session.isOver() && session.getTick() < maxTicks) {
+        typist.act(session);
+        session.update();
+    }
+
+    auto result = SessionResult();
+    result.survivalSeconds = static_cast<float>(session.getTick()) / GameSession::tickRate;
+    result.score = session.getScore();
+    result.hits = typist.getStats().hits;
+    result.misses = typist.getStats().misses;
+    result.survived = session.getHealth() > 0;
+    return result;
+}
+
+template <typename T, typename Projection>
+auto percentile(std::vector<SessionResult>& results, const float& fraction, Projection projection) -> T {
+    auto index = static_cast<std::size_t>(fraction * (results.size() - 1));
+    std::nth_element(results.begin(), results.begin() + index, results.end(),
+        [&projection](const SessionResult& a, const SessionResult& b) {return projection(a) < projection(b);});
+    return projection(results[index]);
+}
+
+struct Aggregate {
+    SimulationConfig config;
+    int sessions = 0;
+    float survivalMean = 0, survivalP10 = 0, survivalP50 = 0, survivalP90 = 0;
+    float scoreMean = 0;
+    int scoreP10 = 0, scoreP50 = 0, scoreP90 = 0;
+    float survivedFraction = 0;
+    float hitsPerMinute = 0;
+    float accuracy = 0;
+};
+
+auto aggregate(const SimulationConfig& config, std::vector<SessionResult>& results) -> Aggregate {
+    auto result = Aggregate();
+    result.config = config;
+    result.sessions = results.size();
+    if (results.empty()) {
+        return result;
+    }
+
+    auto totalSeconds = 0.0, totalScore = 0.0;
+    auto hits = 0ll, misses = 0ll;
+    auto survived = 0;
+    for (const auto& session : results) {
+        totalSeconds += session.survivalSeconds;
+        totalScore += session.score;
+        hits += session.hits;
+        misses += session.misses;
+        survived += session.survived;
+    }
+
+    auto survival = [](const SessionResult& r) {return r.survivalSeconds;};
+    auto score = [](const SessionResult& r) {return r.score;};
+
+    result.survivalMean = totalSeconds / results.size();
+    result.survivalP10 = percentile<float>(results, 0.1f, survival);
+    result.survivalP50 = percentile<float>(results, 0.5f, survival);
+    result.survivalP90 = percentile<float>(results, 0.9f, survival);
+    result.scoreMean = totalScore / results.size();
+    result.scoreP10 = percentile<int>(results, 0.1f, score);
+    result.scoreP50 = percentile<int>(results, 0.5f, score);
+    result.scoreP90 = percentile<int>(results, 0.9f, score);
+    result.survivedFraction = static_cast<float>(survived) / results.size();
+    result.hitsPerMinute = totalSeconds > 0 ? hits / (totalSeconds / 60.0) : 0.0f;
+    result.accuracy = hits + misses > 0 ? static_cast<float>(hits) / (hits + misses) : 0.0f;
+    return result;
+}
+
+auto writeCsv(std::ostream& out, const std::vector<Aggregate>& aggregates) -> void {
+    fmt::print(out, "difficulty,wpm,error_rate,reaction_ms,sessions,survival_mean_s,survival_p10_s,survival_p50_s,survival_p90_s,"
+                    "survived_fraction,score_mean,score_p10,score_p50,score_p90,hits_per_minute,accuracy\n");
+    for (const auto& a : aggregates) {
+        fmt::print(out, "{},{},{},{},{},{:.2f},{:.2f},{:.2f},{:.2f},{:.3f},{:.1f},{},{},{},{:.2f},{:.3f}\n",
+                   difficultyName(a.config.difficulty), a.config.profile.wordsPerMinute, a.config.profile.errorRate,
+                   a.config.profile.reactionMeanMs, a.sessions, a.survivalMean, a.survivalP10, a.survivalP50,
+                   a.survivalP90, a.survivedFraction, a.scoreMean, a.scoreP10, a.scoreP50, a.scoreP90,
+                   a.hitsPerMinute, a.accuracy);
+    }
+}
+
+auto writeJson(std::ostream& out, const std::vector<Aggregate>& aggregates, const double& wallSeconds, const double& simulatedSeconds) -> void {
+    fmt::print(out, "{{\n  \"wall_seconds\": {:.3f},\n  \"simulated_seconds_per_wall_second\": {:.0f},\n  \"results\": [\n",
+               wallSeconds, wallSeconds > 0 ? simulatedSeconds / wallSeconds : 0.0);
+    for (auto i = 0; i < aggregates.size(); i++) {
+        const auto& a = aggregates[i];
+        fmt::print(out, "    {{\"difficulty\": \"{}\", \"wpm\": {}, \"error_rate\": {}, \"reaction_ms\": {}, \"sessions\": {}, "
+                        "\"survival_s\": {{\"mean\": {:.2f}, \"p10\": {:.2f}, \"p50\": {:.2f}, \"p90\": {:.2f}}}, "
+                        "\"survived_fraction\": {:.3f}, "
+                        "\"score\": {{\"mean\": {:.1f}, \"p10\": {}, \"p50\": {}, \"p90\": {}}}, "
+                        "\"hits_per_minute\": {:.2f}, \"accuracy\": {:.3f}}}{}\n",
+                   difficultyName(a.config.difficulty), a.config.profile.wordsPerMinute, a.config.profile.errorRate,
+                   a.config.profile.reactionMeanMs, a.sessions, a.survivalMean, a.survivalP10, a.survivalP50,
+                   a.survivalP90, a.survivedFraction, a.scoreMean, a.scoreP10, a.scoreP50, a.scoreP90,
+                   a.hitsPerMinute, a.accuracy, i + 1 < aggregates.size() ? "," : "");
+    }
+    fmt::print(out, "  ]\n}}\n");
+}
+
+int main(int argc, char** argv) {
+    auto options = Options();
+    try {
+        options = parseOptions(argc, argv);
+    } catch (const std::exception& e) {
+        fmt::print(stderr, "{}\n", e.what());
+        return 1;
+    }
+
+    auto wordList = loadWordList(options.package);
+    if (wordList.empty()) {
+        fmt::print(stderr, "Could not load any words from {}\n", options.package);
+        return 1;
+    }
+
+    auto configs = std::vector<SimulationConfig>();
+    for (const auto& difficulty : options.difficulties) {
+        for (const auto& wpm : options.wordsPerMinute) {
+            for (const auto& errorRate : options.errorRates) {
+                for (const auto& reactionMs : options.reactionMeansMs) {
+                    configs.push_back({difficulty, {wpm, errorRate, reactionMs, options.reactionStdDevMs}, options.typoTolerance});
+                }
+            }
+        }
+    }
+
+    //With --generated the package only trains the generator, sessions spawn made up words
+    auto wordGenerator = MarkovWordGenerator();
+    if (options.generated) {
+        wordGenerator.train(wordList);
+    }
+
+    if (!options.level.empty() && !LevelReader().open(options.level)) {
+        fmt::print(stderr, "Could not open level {}\n", options.level);
+        return 1;
+    }
+
+    //The simulator would rather wait for the flusher than lose events
+    auto eventLog = EventLog(true);
+    if (!options.eventLog.empty() && !eventLog.open(options.eventLog)) {
+        fmt::print(stderr, "Could not open event log {}\n", options.eventLog);
+        return 1;
+    }
+
+    //Opened before the run so a bad path does not cost the whole simulation
+    auto file = std::ofstream();
+    if (!options.output.empty()) {
+        file.open(options.output);
+        if (!file.is_open()) {
+            fmt::print(stderr, "Could not open {}\n", options.output);
+            return 1;
+        }
+    }
+
+    auto results = std::vector<std::vector<SessionResult>>(configs.size(), std::vector<SessionResult>(options.sessions));
+    auto start = std::chrono::steady_clock::now();
+    {
+        auto pool = WorkStealingPool(options.threads);
+        for (auto c = 0; c < configs.size(); c++) {
+            for (auto s = 0; s < options.sessions; s++) {
+                auto seed = options.seed + static_cast<unsigned int>(c * options.sessions + s);
+                pool.submit([&, c, s, seed] {
+                    auto sessionId = static_cast<std::uint32_t>(c * options.sessions + s);
+                    results[c][s] = runSession(configs[c], wordList, options.maxSeconds, seed,
+                                               options.generated ? &wordGenerator : nullptr,
+                                               eventLog.isOpen() ? &eventLog : nullptr, sessionId, options.level);
+                });
+            }
+        }
+        pool.wait();
+    }
+    auto wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    eventLog.close();
+
+    auto aggregates = std::vector<Aggregate>();
+    auto simulatedSeconds = 0.0;
+    for (auto c = 0; c < configs.size(); c++) {
+        for (const auto& session : results[c]) {
+            simulatedSeconds += session.survivalSeconds;
+        }
+        aggregates.push_back(aggregate(configs[c], results[c]));
+    }
+
+    auto& out = options.output.empty() ? std::cout : static_cast<std::ostream&>(file);
+
+    if (options.format == "json") {
+        writeJson(out, aggregates, wallSeconds, simulatedSeconds);
+    } else {
+        writeCsv(out, aggregates);
+    }
+
+    fmt::print(stderr, "{} sessions in {:.2f}s ({:.0f} sessions/s, {:.0f}x real time)\n",
+               configs.size() * options.sessions, wallSeconds,
+               wallSeconds > 0 ? configs.size() * options.sessions / wallSeconds : 0.0,
+               wallSeconds > 0 ? simulatedSeconds / wallSeconds : 0.0);
+    return 0;
+}
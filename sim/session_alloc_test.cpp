@@ -0,0 +1,93 @@
+#include <string>
+#include <vector>
+#include <fmt/format.h>
+#include "../GameSession.h"
+#include "../core/AllocationTracker.h"
+#include "../core/EventLog.h"
+#include "../core/MarkovWordGenerator.h"
+
+// Plays headless rounds the way Game drives them, input then update every tick, and fails when a
+// steady tick allocates. Catches what --alloc-guard would, without a window or a GPU.
+// Built with MONKEYTYPER_TRACK_ALLOCATIONS on its own, registered with ctest as session_alloc.
+
+constexpr int warmupTicks = 60;
+constexpr int roundTicks = 60 * 60;
+
+struct Round {
+    Difficulty difficulty;
+    bool generated;
+    bool eventLog;
+};
+
+auto getRoundName(const Round& round) -> std::string {
+    auto difficulty = round.difficulty == Difficulty::Easy ? "easy" : round.difficulty == Difficulty::Medium ? "medium" : "hard";
+    return fmt::format("{}{}{}", difficulty, round.generated ? " generated" : "", round.eventLog ? " event-log" : "");
+}
+
+//A perfect typist that finishes the oldest word every 20 ticks, so rounds last and every kind of tick comes up
+auto type(GameSession& session, const std::uint64_t& tick) -> void {
+    if (tick % 20 != 0 || session.getWords().size() == 0) {
+        return;
+    }
+    for (auto c : session.getWords().begin()->getText()) {
+        session.typeCharacter(c);
+    }
+    session.submit();
+}
+
+auto playRound(const Round& round, const std::vector<std::string>& wordList, const MarkovWordGenerator& wordGenerator) -> bool {
+    auto eventLog = EventLog(true);
+    if (round.eventLog && !eventLog.open("session_alloc_test_events.bin")) {
+        fmt::print(stderr, "Could not open the event log\n");
+        return false;
+    }
+    eventLog.attachThread();
+
+    auto session = GameSession(wordList, Difficulty::Easy, 1, 800.0f);
+    session.setWordGenerator(round.generated ? &wordGenerator : nullptr);
+    session.setEventLog(eventLog.isOpen() ? &eventLog : nullptr, 1);
+    session.reset(round.difficulty);
+
+    auto monitor = AllocationMonitor(getRoundName(round), {AllocationPhase::Input, AllocationPhase::Update}, roundTicks);
+    auto clean = true;
+    for (auto tick = 1; tick <= roundTicks && !session.isOver(); tick++) {
+        {
+            auto scope = AllocationScope(AllocationPhase::Input);
+            type(session, session.getTick());
+        }
+        {
+            auto scope = AllocationScope(AllocationPhase::Update);
+            session.update();
+        }
+        clean &= monitor.endFrame(tick > warmupTicks);
+    }
+
+    fmt::print(stderr, "{}: {} ticks, {} spawns, {}\n", getRoundName(round), session.getTick(), session.getSpawnCount(),
+               clean ? "no allocations" : "allocated");
+    return clean && session.getTick() > warmupTicks;
+}
+
+int main() {
+    if (!AllocationTracker::isEnabled()) {
+        fmt::print(stderr, "Needs MONKEYTYPER_TRACK_ALLOCATIONS\n");
+        return 1;
+    }
+
+    //Longer than the small string buffer, so input that only fits on the heap is covered too
+    auto wordList = std::vector<std::string>{
+        "monkey", "banana", "jungle", "keyboard", "typewriter", "letter", "swing", "vine", "coconut", "parrot",
+        "characteristically", "counterproductive", "internationalization", "a", "be", "tree", "river", "stone"
+    };
+    auto wordGenerator = MarkovWordGenerator();
+    wordGenerator.train(wordList);
+
+    auto passed = true;
+    for (auto difficulty : {Difficulty::Easy, Difficulty::Medium, Difficulty::Hard}) {
+        for (auto generated : {false, true}) {
+            for (auto eventLog : {false, true}) {
+                passed &= playRound({difficulty, generated, eventLog}, wordList, wordGenerator);
+            }
+        }
+    }
+    return passed ? 0 : 1;
+}
\ No newline at end of file
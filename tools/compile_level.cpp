@@ -0,0 +1,37 @@
+#include <fstream>
+#include <stdexcept>
+#include <fmt/format.h>
+#include "../core/LevelCompiler.h"
+#include "../core/LevelReader.h"
+
+// Compiles a level script into the binary timeline the game and the simulator play with --level, e.g.
+// monkeytyper_compile_level assets/levels/waves.txt assets/levels/waves.bin
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        fmt::print(stderr, "Usage: monkeytyper_compile_level <level.txt> <level.bin>\n");
+        return 1;
+    }
+
+    auto script = std::ifstream(argv[1]);
+    if (!script.is_open()) {
+        fmt::print(stderr, "Could not open {}\n", argv[1]);
+        return 1;
+    }
+
+    auto timeline = std::ofstream(argv[2], std::ios::binary);
+    if (!timeline.is_open()) {
+        fmt::print(stderr, "Could not open {}\n", argv[2]);
+        return 1;
+    }
+
+    try {
+        auto summary = LevelCompiler::compile(script, timeline);
+        fmt::print(stderr, "{} spawns over {:.1f}s in {} bytes\n", summary.events,
+                   static_cast<double>(summary.ticks) / LevelFormat::ticksPerSecond, summary.bytes);
+    } catch (const std::runtime_error& e) {
+        fmt::print(stderr, "{}: {}\n", argv[1], e.what());
+        return 1;
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <fmt/format.h>
+#include "../core/EventLog.h"
+#include "../enums/GameState.h"
+
+// Turns a binary event log written with --event-log into CSV, one row per event, e.g.
+// monkeytyper_decode_events events.bin events.csv
+
+auto eventName(const GameEventType& type) -> std::string_view {
+    switch (type) {
+        case GameEventType::Spawn: return "spawn";
+        case GameEventType::Hit: return "hit";
+        case GameEventType::Miss: return "miss";
+        case GameEventType::Damage: return "damage";
+        case GameEventType::Pause: return "pause";
+        case GameEventType::Resume: return "resume";
+        case GameEventType::StateChange: return "state";
+        default: return "unknown";
+    }
+}
+
+auto stateName(const float& state) -> std::string_view {
+    switch (static_cast<GameState>(state)) {
+        case GameState::Menu: return "menu";
+        case GameState::Game: return "game";
+        case GameState::GameOver: return "game_over";
+        case GameState::Settings: return "settings";
+        case GameState::SettingsDifficulty: return "settings_difficulty";
+        case GameState::SettingsWordPackage: return "settings_word_package";
+        case GameState::SettingsFont: return "settings_font";
+        case GameState::SettingsFramePacing: return "settings_frame_pacing";
+        case GameState::SettingsTypoTolerance: return "settings_typo_tolerance";
+        case GameState::Leaderboard: return "leaderboard";
+        case GameState::Pause: return "pause";
+        default: return "unknown";
+    }
+}
+
+auto writeRow(std::FILE* out, const GameEventRecord& record) -> void {
+    auto word = std::string_view(record.word.data(), record.wordLength);
+    fmt::print(out, "{},{},{:.6f},{},{},", record.session, record.tick, record.timeUs / 1e6, eventName(record.type), word);
+
+    //y,speed,on_screen_s,distance,health,from_state,to_state
+    switch (record.type) {
+        case GameEventType::Spawn:
+            fmt::print(out, "{},{},,,,,\n", record.value0, record.value1);
+            break;
+        case GameEventType::Hit:
+            fmt::print(out, ",,{:.3f},{},,,\n", record.value0, record.value1);
+            break;
+        case GameEventType::Damage:
+            fmt::print(out, ",,,,{},,\n", record.value0);
+            break;
+        case GameEventType::StateChange:
+            fmt::print(out, ",,,,,{},{}\n", stateName(record.value0), stateName(record.value1));
+            break;
+        default:
+            fmt::print(out, ",,,,,,\n");
+            break;
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2 || argc > 3) {
+        fmt::print(stderr, "Usage: monkeytyper_decode_events <events.bin> [events.csv]\n");
+        return 1;
+    }
+
+    auto in = std::fopen(argv[1], "rb");
+    if (!in) {
+        fmt::print(stderr, "Could not open {}\n", argv[1]);
+        return 1;
+    }
+
+    auto header = EventLogFormat::Header();
+    if (std::fread(&header, sizeof(header), 1, in) != 1 || header.magic != EventLogFormat::magic
+        || header.version != EventLogFormat::version || header.recordSize != sizeof(GameEventRecord)) {
+        fmt::print(stderr, "{} is not a version {} event log\n", argv[1], EventLogFormat::version);
+        std::fclose(in);
+        return 1;
+    }
+
+    auto out = argc == 3 ? std::fopen(argv[2], "w") : stdout;
+    if (!out) {
+        fmt::print(stderr, "Could not open {}\n", argv[2]);
+        std::fclose(in);
+        return 1;
+    }
+
+    fmt::print(out, "session,tick,time_s,event,word,y,speed,on_screen_s,distance,health,from_state,to_state\n");
+    auto record = GameEventRecord();
+    auto count = 0ull;
+    while (std::fread(&record, sizeof(record), 1, in) == 1) {
+        writeRow(out, record);
+        count++;
+    }
+
+    fmt::print(stderr, "{} events\n", count);
+    std::fclose(in);
+    if (out != stdout) {
+        std::fclose(out);
+    }
+    return 0;
+}
\ No newline at end of file